@@ -83,4 +83,18 @@ namespace {
     }
     // In order to generate the additional wrapper for Fortran array, the *_WRAPPED_* versions need to be used
     BINDGEN_EXPORT_BINDING_WRAPPED_2(transform_c_to_f, transform_c_to_f_impl<data_store_t>);
+
+    // Runs the stencil directly on the Fortran arrays if the backend layout allows it (cpu_ifirst), otherwise the data
+    // goes through the data stores: `in` is transformed to C layout before and `out` back to Fortran after the run.
+    template <class D>
+    void run_copy_stencil_fortran_impl(fortran_array_adapter<D> in, fortran_array_adapter<D> out, D in_c, D out_c) {
+        auto &&lengths = out_c->lengths();
+        auto grid = make_grid(lengths[0], lengths[1], lengths[2]);
+        run_single_stage(copy_functor(), stencil_backend_t(), grid, in.sid(in_c), out.sid(out_c, false));
+#ifdef GT_CUDACC
+        GT_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+        out.write_back(out_c);
+    }
+    BINDGEN_EXPORT_BINDING_WRAPPED_4(run_copy_stencil_fortran, run_copy_stencil_fortran_impl<data_store_t>);
 } // namespace
@@ -9,9 +9,20 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "../common/array.hpp"
 #include "../common/defs.hpp"
 #include "../common/halo_descriptor.hpp"
+#include "../common/integral_constant.hpp"
+#include "../common/omp.hpp"
+#include "../common/tuple_util.hpp"
+#include "../meta/first.hpp"
+#include "../meta/list.hpp"
 #include "direction.hpp"
 #include "predicate.hpp"
 
@@ -26,6 +37,119 @@ namespace gridtools {
          * @{
          */
 
+        namespace apply_impl_ {
+            /**
+             *  A box of the halo points (the bounds are inclusive) to which the boundary condition is applied in the
+             *  given direction.
+             */
+            struct slab {
+                int_t direction;
+                array<int_t, 3> low;
+                array<int_t, 3> high;
+            };
+
+            // the direction is encoded as `9 * (i + 1) + 3 * (j + 1) + k + 1`; 13 is the interior and never used
+            template <int_t Id>
+            using direction_of = direction<sign(Id / 9 - 1), sign(Id / 3 % 3 - 1), sign(Id % 3 - 1)>;
+
+            template <int_t... Ids>
+            std::integer_sequence<int_t, (Ids < 13 ? Ids : Ids + 1)...> skip_interior(
+                std::integer_sequence<int_t, Ids...>);
+
+            // the ids of the 26 halo directions
+            using halo_ids_t = decltype(skip_interior(std::make_integer_sequence<int_t, 26>()));
+
+            /**
+             *  The innermost dimension of the traversal: the one of the first data field which has a unit stride known
+             *  at compile time, or the first dimension if there is none.
+             */
+            template <class DataFieldView, class = void>
+            struct inner_dim : std::integral_constant<int_t, 0> {};
+
+            template <class DataFieldView>
+            struct inner_dim<DataFieldView,
+                std::void_t<decltype(std::declval<DataFieldView const &>().native_strides())>> {
+                using strides_t = std::decay_t<decltype(std::declval<DataFieldView const &>().native_strides())>;
+
+                template <size_t D>
+                static constexpr bool is_unit =
+                    std::is_same_v<std::decay_t<tuple_util::element<D, strides_t>>, integral_constant<int, 1>>;
+
+                static constexpr int_t value = is_unit<1> ? 1 : is_unit<2> ? 2 : 0;
+            };
+
+            /**
+             *  The order in which the dimensions are traversed (from the outermost to the innermost): the innermost
+             *  dimension is given, the other two go by decreasing strides of the first data field. Masked dimensions
+             *  (zero stride) go outermost.
+             */
+            template <int_t Inner, class DataFieldView>
+            auto loop_order_impl(DataFieldView const &view, int) -> decltype(view.strides(), array<int_t, 3>()) {
+                auto &&strides = view.strides();
+                auto key = [&](int_t d) {
+                    auto s = strides[d];
+                    return s == 0 ? std::numeric_limits<decltype(s)>::max() : s;
+                };
+                int_t outer = (Inner + 1) % 3;
+                int_t middle = (Inner + 2) % 3;
+                if (key(outer) < key(middle))
+                    std::swap(outer, middle);
+                return {outer, middle, Inner};
+            }
+
+            template <int_t Inner, class DataFieldView>
+            array<int_t, 3> loop_order_impl(DataFieldView const &, long) {
+                return {(Inner + 1) % 3, (Inner + 2) % 3, Inner};
+            }
+
+            template <int_t Inner, class DataFieldView, class... DataFieldViews>
+            array<int_t, 3> loop_order(DataFieldView const &view, DataFieldViews const &...) {
+                return loop_order_impl<Inner>(view, 0);
+            }
+
+            // the minimal number of points in a chunk of a slab
+            constexpr int_t min_chunk_size = 256;
+
+            /**
+             *  Splits the slabs along their outermost dimension into up to `4 * threads` chunks of at least
+             *  `min_chunk_size` points, so that even a thin slab can be shared between the threads. The chunks of a
+             *  slab are contiguous in the result and the order of the slabs is kept.
+             */
+            inline std::vector<slab> make_work_list(std::vector<slab> const &slabs, array<int_t, 3> const &order) {
+                auto outer = order[0];
+                auto volume = [](slab const &s) {
+                    return (s.high[0] - s.low[0] + 1) * (s.high[1] - s.low[1] + 1) * (s.high[2] - s.low[2] + 1);
+                };
+                int_t max_chunks = 4 * omp_get_max_threads();
+                std::vector<slab> res;
+                for (auto &&s : slabs) {
+                    int_t extent = s.high[outer] - s.low[outer] + 1;
+                    int_t chunks = std::min({extent, max_chunks, std::max(int_t(1), volume(s) / min_chunk_size)});
+                    for (int_t c = 0; c < chunks; ++c) {
+                        slab cur = s;
+                        cur.low[outer] = s.low[outer] + extent * c / chunks;
+                        cur.high[outer] = s.low[outer] + extent * (c + 1) / chunks - 1;
+                        res.push_back(cur);
+                    }
+                }
+                return res;
+            }
+
+            /**
+             *  Restricts the slab in the dimension to the halo points adjacent to the block `[first, first + size)` of
+             *  the compute domain. Returns false if there are no such points.
+             */
+            inline bool clip(slab &s, int_t dim, int_t sign, halo_descriptor const &hd, int_t first, int_t size) {
+                if (sign < 0)
+                    return first == 0;
+                if (sign > 0)
+                    return first + size == int_t(hd.end() - hd.begin() + 1);
+                s.low[dim] = std::max(s.low[dim], int_t(hd.begin()) + first);
+                s.high[dim] = std::min(s.high[dim], int_t(hd.begin()) + first + size - 1);
+                return s.low[dim] <= s.high[dim];
+            }
+        } // namespace apply_impl_
+
         template <typename BoundaryFunction,
             typename Predicate = default_predicate,
             typename HaloDescriptors = array<halo_descriptor, 3u>>
@@ -35,24 +159,78 @@ namespace gridtools {
             BoundaryFunction const boundary_function;
             Predicate predicate;
 
-            /** @brief loops on the halo region defined by the HaloDescriptor member parameter, and evaluates the
-               boundary_function in the specified direction, in the specified halo node.
-                this macro expands to n definitions of the function loop, taking a number of arguments ranging from 0 to
-               n (DataField0, Datafield1, DataField2, ...)*/
-            template <typename Direction, typename... DataField>
-            void loop(DataField &...data_field) const {
-                const int_t i_low = halo_descriptors[0].loop_low_bound_outside(Direction::i);
-                const int_t i_high = halo_descriptors[0].loop_high_bound_outside(Direction::i);
-                const int_t j_low = halo_descriptors[1].loop_low_bound_outside(Direction::j);
-                const int_t j_high = halo_descriptors[1].loop_high_bound_outside(Direction::j);
-                const int_t k_low = halo_descriptors[2].loop_low_bound_outside(Direction::k);
-                const int_t k_high = halo_descriptors[2].loop_high_bound_outside(Direction::k);
-
-#pragma omp parallel for simd collapse(3)
-                for (int_t j = j_low; j <= j_high; ++j)
-                    for (int_t k = k_low; k <= k_high; ++k)
-                        for (int_t i = i_low; i <= i_high; ++i)
-                            boundary_function(Direction(), data_field..., i, j, k);
+            /** @brief evaluates the boundary_function in the specified direction in all the points of the slab,
+               traversing the dimensions in the given order. The innermost dimension is known at compile time.
+             */
+            template <typename Direction, int_t Inner, typename... DataField>
+            void loop(apply_impl_::slab const &s, array<int_t, 3> const &order, DataField &...data_field) const {
+                const int_t outer = order[0];
+                const int_t middle = order[1];
+                const int_t low = s.low[Inner];
+                const int_t high = s.high[Inner];
+                array<int_t, 3> pos = {};
+                for (pos[outer] = s.low[outer]; pos[outer] <= s.high[outer]; ++pos[outer])
+                    for (pos[middle] = s.low[middle]; pos[middle] <= s.high[middle]; ++pos[middle]) {
+                        const int_t i = pos[0];
+                        const int_t j = pos[1];
+                        const int_t k = pos[2];
+                        if constexpr (Inner == 0)
+#pragma omp simd
+                            for (int_t n = low; n <= high; ++n)
+                                boundary_function(Direction(), data_field..., n, j, k);
+                        else if constexpr (Inner == 1)
+#pragma omp simd
+                            for (int_t n = low; n <= high; ++n)
+                                boundary_function(Direction(), data_field..., i, n, k);
+                        else
+#pragma omp simd
+                            for (int_t n = low; n <= high; ++n)
+                                boundary_function(Direction(), data_field..., i, j, n);
+                    }
+            }
+
+            /** @brief appends the halo region in the direction to the slabs if the predicate holds and it is not
+               empty.
+             */
+            template <typename Direction>
+            void add_slab(int_t id, std::vector<apply_impl_::slab> &slabs) const {
+                if (!predicate(Direction()))
+                    return;
+                apply_impl_::slab s = {id,
+                    {halo_descriptors[0].loop_low_bound_outside(Direction::i),
+                        halo_descriptors[1].loop_low_bound_outside(Direction::j),
+                        halo_descriptors[2].loop_low_bound_outside(Direction::k)},
+                    {halo_descriptors[0].loop_high_bound_outside(Direction::i),
+                        halo_descriptors[1].loop_high_bound_outside(Direction::j),
+                        halo_descriptors[2].loop_high_bound_outside(Direction::k)}};
+                if (s.low[0] <= s.high[0] && s.low[1] <= s.high[1] && s.low[2] <= s.high[2])
+                    slabs.push_back(s);
+            }
+
+            template <int_t... Ids>
+            std::vector<apply_impl_::slab> make_slabs(std::integer_sequence<int_t, Ids...>) const {
+                std::vector<apply_impl_::slab> res;
+                (..., add_slab<apply_impl_::direction_of<Ids>>(Ids, res));
+                return res;
+            }
+
+            template <typename... DataFieldViews>
+            using loop_t = void (boundary_apply::*)(
+                apply_impl_::slab const &, array<int_t, 3> const &, DataFieldViews const &...) const;
+
+            template <int_t Id, int_t Inner, typename... DataFieldViews>
+            static constexpr loop_t<DataFieldViews...> loop_of() {
+                if constexpr (Id == 13)
+                    return nullptr;
+                else
+                    return &boundary_apply::loop<apply_impl_::direction_of<Id>, Inner, DataFieldViews const...>;
+            }
+
+            // the loops indexed by the direction id, the interior has none
+            template <int_t Inner, typename... DataFieldViews, int_t... Ids>
+            static auto const &loops(std::integer_sequence<int_t, Ids...>) {
+                static constexpr loop_t<DataFieldViews...> res[27] = {loop_of<Ids, Inner, DataFieldViews...>()...};
+                return res;
             }
 
           public:
@@ -65,75 +243,65 @@ namespace gridtools {
             /**
                @brief applies the boundary conditions looping on the halo region defined by the member parameter, in all
             possible directions.
-            this macro expands to n definitions of the function apply, taking a number of arguments ranging from 0 to n
-            (DataField0, Datafield1, DataField2, ...)
 
+            The directions selected by the predicate are processed one after another in the fixed order (from
+            `direction<minus_, minus_, minus_>` to `direction<plus_, plus_, plus_>`, the last sign varying fastest),
+            so a boundary function may read the halo points written in the earlier directions. All of them are
+            processed within a single parallel region: the halo region of a direction is split into chunks which are
+            shared between the threads, and the threads synchronize before the next direction. The points are
+            traversed following the strides of the first data field. The boundary function is never called with
+            `direction<zero_, zero_, zero_>`.
             */
             template <typename... DataFieldViews>
             void apply(DataFieldViews const &...data_field_views) const {
+                constexpr int_t inner = apply_impl_::inner_dim<meta::first<meta::list<DataFieldViews...>>>::value;
+                auto order = apply_impl_::loop_order<inner>(data_field_views...);
+                auto work = apply_impl_::make_work_list(make_slabs(apply_impl_::halo_ids_t()), order);
+                auto &&inner_loops = loops<inner, DataFieldViews...>(std::make_integer_sequence<int_t, 27>());
+                int_t size = work.size();
+                // the bounds of the chunks of every direction in the work list
+                std::vector<int_t> bounds = {0};
+                for (int_t n = 1; n <= size; ++n)
+                    if (n == size || work[n].direction != work[n - 1].direction)
+                        bounds.push_back(n);
+                int_t directions = bounds.size() - 1;
+#pragma omp parallel
+                for (int_t d = 0; d < directions; ++d) {
+#pragma omp for schedule(dynamic)
+                    for (int_t n = bounds[d]; n < bounds[d + 1]; ++n)
+                        (this->*inner_loops[work[n].direction])(work[n], order, data_field_views...);
+                }
+            }
+
+            /**
+               @brief the halo regions of the directions selected by the predicate, in the order of `apply`. They do not
+            depend on the data fields, so they can be computed once for all the calls of `apply_block`.
+            */
+            std::vector<apply_impl_::slab> halo_slabs() const { return make_slabs(apply_impl_::halo_ids_t()); }
+
+            /**
+               @brief applies the boundary conditions only to the halo points of the slabs (see `halo_slabs`) adjacent
+            to the given block of the compute domain, sequentially.
 
-                if (predicate(direction<minus_, minus_, minus_>()))
-                    this->loop<direction<minus_, minus_, minus_>>(data_field_views...);
-                if (predicate(direction<minus_, minus_, zero_>()))
-                    this->loop<direction<minus_, minus_, zero_>>(data_field_views...);
-                if (predicate(direction<minus_, minus_, plus_>()))
-                    this->loop<direction<minus_, minus_, plus_>>(data_field_views...);
-
-                if (predicate(direction<minus_, zero_, minus_>()))
-                    this->loop<direction<minus_, zero_, minus_>>(data_field_views...);
-                if (predicate(direction<minus_, zero_, zero_>()))
-                    this->loop<direction<minus_, zero_, zero_>>(data_field_views...);
-                if (predicate(direction<minus_, zero_, plus_>()))
-                    this->loop<direction<minus_, zero_, plus_>>(data_field_views...);
-
-                if (predicate(direction<minus_, plus_, minus_>()))
-                    this->loop<direction<minus_, plus_, minus_>>(data_field_views...);
-                if (predicate(direction<minus_, plus_, zero_>()))
-                    this->loop<direction<minus_, plus_, zero_>>(data_field_views...);
-                if (predicate(direction<minus_, plus_, plus_>()))
-                    this->loop<direction<minus_, plus_, plus_>>(data_field_views...);
-
-                if (predicate(direction<zero_, minus_, minus_>()))
-                    this->loop<direction<zero_, minus_, minus_>>(data_field_views...);
-                if (predicate(direction<zero_, minus_, zero_>()))
-                    this->loop<direction<zero_, minus_, zero_>>(data_field_views...);
-                if (predicate(direction<zero_, minus_, plus_>()))
-                    this->loop<direction<zero_, minus_, plus_>>(data_field_views...);
-
-                if (predicate(direction<zero_, zero_, minus_>()))
-                    this->loop<direction<zero_, zero_, minus_>>(data_field_views...);
-                if (predicate(direction<zero_, zero_, plus_>()))
-                    this->loop<direction<zero_, zero_, plus_>>(data_field_views...);
-
-                if (predicate(direction<zero_, plus_, minus_>()))
-                    this->loop<direction<zero_, plus_, minus_>>(data_field_views...);
-                if (predicate(direction<zero_, plus_, zero_>()))
-                    this->loop<direction<zero_, plus_, zero_>>(data_field_views...);
-                if (predicate(direction<zero_, plus_, plus_>()))
-                    this->loop<direction<zero_, plus_, plus_>>(data_field_views...);
-
-                if (predicate(direction<plus_, minus_, minus_>()))
-                    this->loop<direction<plus_, minus_, minus_>>(data_field_views...);
-                if (predicate(direction<plus_, minus_, zero_>()))
-                    this->loop<direction<plus_, minus_, zero_>>(data_field_views...);
-                if (predicate(direction<plus_, minus_, plus_>()))
-                    this->loop<direction<plus_, minus_, plus_>>(data_field_views...);
-
-                if (predicate(direction<plus_, zero_, minus_>()))
-                    this->loop<direction<plus_, zero_, minus_>>(data_field_views...);
-                if (predicate(direction<plus_, zero_, zero_>()))
-                    this->loop<direction<plus_, zero_, zero_>>(data_field_views...);
-                if (predicate(direction<plus_, zero_, plus_>()))
-                    this->loop<direction<plus_, zero_, plus_>>(data_field_views...);
-
-                if (predicate(direction<plus_, plus_, minus_>()))
-                    this->loop<direction<plus_, plus_, minus_>>(data_field_views...);
-                if (predicate(direction<plus_, plus_, zero_>()))
-                    this->loop<direction<plus_, plus_, zero_>>(data_field_views...);
-                if (predicate(direction<plus_, plus_, plus_>()))
-                    this->loop<direction<plus_, plus_, plus_>>(data_field_views...);
-
-                // apply(data_field_views ...);
+            The block is given in the coordinates of the compute domain, i.e. relative to `begin()` of the i- and j-
+            halo descriptors. The halo points of the i and j boundaries are assigned to the blocks that touch the
+            boundary, those of the k boundaries to the block which has the same horizontal position. Hence, applying
+            it to all the blocks of a partition of the compute domain (possibly concurrently) is equivalent to `apply`.
+            */
+            template <typename... DataFieldViews>
+            void apply_block(std::vector<apply_impl_::slab> const &slabs,
+                int_t i_first,
+                int_t j_first,
+                int_t i_size,
+                int_t j_size,
+                DataFieldViews const &...data_field_views) const {
+                constexpr int_t inner = apply_impl_::inner_dim<meta::first<meta::list<DataFieldViews...>>>::value;
+                auto order = apply_impl_::loop_order<inner>(data_field_views...);
+                auto &&inner_loops = loops<inner, DataFieldViews...>(std::make_integer_sequence<int_t, 27>());
+                for (auto s : slabs)
+                    if (apply_impl_::clip(s, 0, s.direction / 9 - 1, halo_descriptors[0], i_first, i_size) &&
+                        apply_impl_::clip(s, 1, s.direction / 3 % 3 - 1, halo_descriptors[1], j_first, j_size))
+                        (this->*inner_loops[s.direction])(s, order, data_field_views...);
             }
 
           private:
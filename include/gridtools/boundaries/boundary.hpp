@@ -9,6 +9,10 @@
  */
 #pragma once
 
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "../common/defs.hpp"
 #include "../gcl/low_level/arch.hpp"
 #include "apply.hpp"
@@ -39,6 +43,44 @@ namespace gridtools {
                 using type = boundary_apply_gpu<BoundaryFunction, Predicate>;
             };
 #endif
+
+            /**
+               @brief The epilogue of a stencil computation which applies the boundary conditions to the fields.
+
+               Called without arguments, it applies the boundary conditions on the whole halo region. Called with a
+               block of the compute domain, it applies them only to the adjacent halo points (see
+               `boundary_apply::apply_block`); this is available only for the host boundary conditions. The halo
+               regions are computed once, when the epilogue is made.
+             */
+            template <typename BcApply, typename... Views>
+            struct epilogue {
+                BcApply bc_apply;
+                std::tuple<Views...> views;
+                std::vector<apply_impl_::slab> slabs;
+
+                void operator()() const {
+                    std::apply([this](auto const &...views) { bc_apply.apply(views...); }, views);
+                }
+
+                void operator()(int_t i_first, int_t j_first, int_t i_size, int_t j_size) const {
+                    std::apply(
+                        [&](auto const &...views) {
+                            bc_apply.apply_block(slabs, i_first, j_first, i_size, j_size, views...);
+                        },
+                        views);
+                }
+            };
+
+            template <typename BcApply>
+            auto halo_slabs(BcApply const &bc_apply, int) -> decltype(bc_apply.halo_slabs()) {
+                return bc_apply.halo_slabs();
+            }
+
+            // the device boundary conditions are never applied by blocks
+            template <typename BcApply>
+            std::vector<apply_impl_::slab> halo_slabs(BcApply const &, long) {
+                return {};
+            }
             /** @} */
         } // namespace _impl
 
@@ -69,6 +111,19 @@ namespace gridtools {
             void apply(DataFields &...data_fields) const {
                 bc_apply.apply(data_fields->target_view()...);
             }
+
+            /**
+               @brief Makes the epilogue for `stencil::run_with_epilogue` which applies the boundary conditions to the
+               data fields as a part of the stencil computation.
+
+               The compute domain of the stencil should match the halo descriptors in the i and j dimensions and the
+               data fields should not be read by the stencil with a non-zero horizontal extent.
+             */
+            template <typename... DataFields>
+            auto epilogue(DataFields &...data_fields) const {
+                return _impl::epilogue<bc_apply_t, decltype(data_fields->target_view())...>{
+                    bc_apply, {data_fields->target_view()...}, _impl::halo_slabs(bc_apply, 0)};
+            }
         };
 
         template <class Arch, class BoundaryFunction, class Predicate = default_predicate>
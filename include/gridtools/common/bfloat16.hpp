@@ -0,0 +1,49 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "host_device.hpp"
+
+namespace gridtools {
+    /**
+     *  Software emulated `bfloat16` number: the upper half of an IEEE 754 single precision float.
+     *
+     *  It is a storage only type. Arithmetics is done after conversion to `float` (or wider).
+     *  Conversion from `float` rounds to nearest even, NaNs are kept quiet.
+     */
+    class bfloat16 {
+        std::uint16_t m_bits;
+
+        static GT_FUNCTION std::uint16_t from_float(float val) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &val, sizeof(bits));
+            if ((bits & 0x7fffffffu) > 0x7f800000u)
+                return (bits >> 16) | 0x40u;
+            bits += 0x7fffu + ((bits >> 16) & 1u);
+            return bits >> 16;
+        }
+
+      public:
+        bfloat16() = default;
+        GT_FUNCTION bfloat16(float val) : m_bits(from_float(val)) {}
+
+        GT_FUNCTION operator float() const {
+            std::uint32_t bits = std::uint32_t(m_bits) << 16;
+            float res;
+            std::memcpy(&res, &bits, sizeof(res));
+            return res;
+        }
+
+        GT_FUNCTION std::uint16_t bits() const { return m_bits; }
+    };
+} // namespace gridtools
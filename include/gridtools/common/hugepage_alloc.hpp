@@ -125,6 +125,9 @@ namespace gridtools {
             return {ptr, size};
         }
 
+        // fresh anonymous mappings are zero filled by the kernel
+        inline bool is_zero_filled(hugepage_mode mode) { return mode != hugepage_mode::disabled; }
+
         inline void deallocate(void *ptr, std::size_t size, hugepage_mode mode) {
             switch (mode) {
             case hugepage_mode::disabled:
@@ -162,6 +165,8 @@ namespace gridtools {
             return {ptr, size};
         }
 
+        inline bool is_zero_filled(hugepage_mode) { return false; }
+
         inline void deallocate(void *ptr, std::size_t, hugepage_mode) { free(ptr); }
 #endif
 
@@ -212,7 +217,18 @@ namespace gridtools {
     }
 
     /**
-     * @brief Frees memory allocated by hugepage_alloc.
+     * @brief Same as hugepage_alloc, but the memory is zero filled. Memory that comes directly from `mmap` is not
+     * written to, so the pages are only touched when they are used for the first time.
+     */
+    inline void *hugepage_calloc(std::size_t size) {
+        void *ptr = hugepage_alloc(size);
+        if (!hugepage_alloc_impl_::is_zero_filled(static_cast<hugepage_alloc_impl_::ptr_metadata *>(ptr)[-1].mode))
+            std::memset(ptr, 0, size);
+        return ptr;
+    }
+
+    /**
+     * @brief Frees memory allocated by hugepage_alloc or hugepage_calloc.
      */
     inline void hugepage_free(void *ptr) {
         if (!ptr)
@@ -9,31 +9,54 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
 #include "../../common/functional.hpp"
 #include "../../common/hymap.hpp"
 #include "../../common/tuple_util.hpp"
+#include "../../meta/last.hpp"
 #include "../../sid/allocator.hpp"
 #include "../../sid/concept.hpp"
 #include "../../sid/contiguous.hpp"
 #include "../../sid/multi_shift.hpp"
+#include "../../sid/sid_shift_origin.hpp"
 #include "../../sid/unknown_kind.hpp"
 #include "../../thread_pool/concept.hpp"
 #include "../../thread_pool/dummy.hpp"
 #include "../../thread_pool/omp.hpp"
+#include "../extents.hpp"
 #include "./common.hpp"
 
 namespace gridtools::fn::backend {
     namespace naive_impl_ {
-        template <class ThreadPool>
-        struct naive_with_threadpool {};
+        /**
+         *  `ColumnLanes` > 1 enables the lock-step execution of the column stages: `ColumnLanes` adjacent columns
+         *  along the first horizontal dimension are processed together, so that the per column work at each level
+         *  can be vectorized. Column stages for which this is not applicable, or whose arguments are not contiguous
+         *  along any horizontal dimension (e.g. the k-first layout), are run column by column. The gain depends on
+         *  the stencil, so this is opt-in; the `naive_lanes` perftests measure it.
+         */
+        template <class ThreadPool, int ColumnLanes = 1>
+        struct naive_with_threadpool {
+            static_assert(ColumnLanes > 0);
+        };
 
-        using naive = naive_with_threadpool<
+        using default_thread_pool_t =
 #if defined(_OPENMP) || defined(GT_HIP_OPENMP_WORKAROUND)
             thread_pool::omp
 #else
             thread_pool::dummy
 #endif
-            >;
+            ;
+
+        using naive = naive_with_threadpool<default_thread_pool_t>;
+
+        template <int ColumnLanes>
+        using naive_column_lanes = naive_with_threadpool<default_thread_pool_t, ColumnLanes>;
 
         template <class ThreadPool, class Sizes, class Dims = meta::rename<hymap::keys, get_keys<Sizes>>>
         auto make_parallel_loops(ThreadPool, Sizes const &sizes) {
@@ -52,8 +75,13 @@ namespace gridtools::fn::backend {
             };
         }
 
-        template <class ThreadPool, class Sizes, class StencilStage, class MakeIterator, class Composite>
-        void apply_stencil_stage(naive_with_threadpool<ThreadPool>,
+        template <class ThreadPool,
+            int ColumnLanes,
+            class Sizes,
+            class StencilStage,
+            class MakeIterator,
+            class Composite>
+        void apply_stencil_stage(naive_with_threadpool<ThreadPool, ColumnLanes>,
             Sizes const &sizes,
             StencilStage,
             MakeIterator &&make_iterator,
@@ -65,14 +93,94 @@ namespace gridtools::fn::backend {
             })(ptr, strides);
         }
 
+        template <class ColumnStage, class Seed, class MakeIterator, class Ptr, class Strides, class = void>
+        struct has_lanes : std::false_type {};
+
+        template <class ColumnStage, class Seed, class MakeIterator, class Ptr, class Strides>
+        struct has_lanes<ColumnStage,
+            Seed,
+            MakeIterator,
+            Ptr,
+            Strides,
+            std::enable_if_t<ColumnStage::template has_lanes<Seed, MakeIterator, Ptr, Strides>>> : std::true_type {};
+
+        template <int ColumnLanes,
+            class LaneDim,
+            class ThreadPool,
+            class Sizes,
+            class ColumnStage,
+            class MakeIterator,
+            class Ptr,
+            class Strides,
+            class Seed>
+        void apply_column_stage_lanes(ThreadPool,
+            Sizes const &h_sizes,
+            std::size_t v_size,
+            ColumnStage,
+            MakeIterator const &make_iterator,
+            Ptr const &ptr,
+            Strides const &strides,
+            Seed const &seed) {
+            using dims_t = meta::rename<hymap::keys, get_keys<Sizes>>;
+            constexpr std::size_t lane_pos = meta::st_position<get_keys<Sizes>, LaneDim>::value;
+            auto const &lane_stride = sid::get_stride<LaneDim>(strides);
+            int n = at_key<LaneDim>(h_sizes);
+            auto loop_f = [&](auto... indices) {
+                auto local_ptr = ptr;
+                sid::multi_shift(local_ptr, strides, dims_t::make_values(indices...));
+                int block = tuple_util::get<lane_pos>(tuple(indices...));
+                sid::shift(local_ptr, lane_stride, block * (ColumnLanes - 1));
+                ColumnStage().template lanes<ColumnLanes>(seed,
+                    v_size,
+                    std::min(ColumnLanes, n - block * ColumnLanes),
+                    make_iterator,
+                    local_ptr,
+                    strides,
+                    lane_stride);
+            };
+            auto loop_sizes = tuple_util::transform([](auto size) { return int(size); }, h_sizes);
+            tuple_util::get<lane_pos>(loop_sizes) = (n + ColumnLanes - 1) / ColumnLanes;
+            tuple_util::apply(
+                [&](auto... sizes) { thread_pool::parallel_for_loop(ThreadPool(), loop_f, sizes...); }, loop_sizes);
+        }
+
+        // the sum of the (integral) strides of all arguments along the given dimension
+        template <class Dim, class Strides>
+        long lane_stride_cost(Strides const &strides) {
+            return tuple_util::fold(
+                [](long acc, auto const &stride) {
+                    if constexpr (std::is_convertible_v<decltype(stride), long>)
+                        return acc + std::abs(long(stride));
+                    else
+                        return acc;
+                },
+                0l,
+                sid::get_stride<Dim>(strides));
+        }
+
+        // whether the lanes along the given dimension are adjacent in memory (or broadcast) for all arguments
+        template <class Dim, class Strides>
+        bool lanes_are_contiguous(Strides const &strides) {
+            return tuple_util::fold(
+                [](bool acc, auto const &stride) {
+                    if constexpr (std::is_convertible_v<decltype(stride), long>)
+                        return acc && std::abs(long(stride)) <= 1;
+                    else
+                        return acc;
+                },
+                true,
+                sid::get_stride<Dim>(strides));
+        }
+
         template <class ThreadPool,
+            int ColumnLanes,
             class Sizes,
             class ColumnStage,
             class MakeIterator,
             class Composite,
             class Vertical,
             class Seed>
-        void apply_column_stage(naive_with_threadpool<ThreadPool>,
+        void apply_column_stage(naive_with_threadpool<ThreadPool, ColumnLanes>,
             Sizes const &sizes,
             ColumnStage,
             MakeIterator &&make_iterator,
@@ -81,31 +189,231 @@ namespace gridtools::fn::backend {
             Seed seed) {
             auto ptr = sid::get_origin(std::forward<Composite>(composite))();
             auto strides = sid::get_strides(std::forward<Composite>(composite));
-            auto v_size = at_key<Vertical>(sizes);
-            make_parallel_loops(ThreadPool(), hymap::canonicalize_and_remove_key<Vertical>(sizes))(
-                [v_size = std::move(v_size), make_iterator = make_iterator(), seed = std::move(seed)](auto ptr,
-                    auto const &strides) { ColumnStage()(seed, v_size, make_iterator, std::move(ptr), strides); })(
-                ptr, strides);
+            auto by_columns = [&] {
+                auto v_size = at_key<Vertical>(sizes);
+                make_parallel_loops(ThreadPool(), hymap::canonicalize_and_remove_key<Vertical>(sizes))(
+                    [v_size = std::move(v_size), make_iterator = make_iterator(), seed = std::move(seed)](auto ptr,
+                        auto const &strides) { ColumnStage()(seed, v_size, make_iterator, std::move(ptr), strides); })(
+                    ptr, strides);
+            };
+            using make_iterator_t = decltype(make_iterator());
+            if constexpr (ColumnLanes > 1 &&
+                          has_lanes<ColumnStage, Seed, make_iterator_t, decltype(ptr), decltype(strides)>::value) {
+                // the columns are packed along the horizontal dimension with the smallest strides; strided lanes
+                // don't vectorize and measured slower than the column by column execution, so they fall back to it
+                auto h_sizes = hymap::canonicalize_and_remove_key<Vertical>(sizes);
+                using h_dims_t = meta::rename<std::tuple, get_keys<decltype(h_sizes)>>;
+                long best_cost = std::numeric_limits<long>::max();
+                int best = 0, i = 0;
+                bool contiguous = false;
+                tuple_util::for_each(
+                    [&](auto dim) {
+                        long cost = lane_stride_cost<decltype(dim)>(strides);
+                        if (cost < best_cost) {
+                            best_cost = cost;
+                            best = i;
+                            contiguous = lanes_are_contiguous<decltype(dim)>(strides);
+                        }
+                        ++i;
+                    },
+                    h_dims_t());
+                if (!contiguous)
+                    return by_columns();
+                i = 0;
+                tuple_util::for_each(
+                    [&](auto dim) {
+                        if (i++ == best)
+                            apply_column_stage_lanes<ColumnLanes, decltype(dim)>(ThreadPool(),
+                                h_sizes,
+                                at_key<Vertical>(sizes),
+                                ColumnStage(),
+                                make_iterator(),
+                                ptr,
+                                strides,
+                                seed);
+                    },
+                    h_dims_t());
+            } else {
+                by_columns();
+            }
+        }
+
+        // runs `f` asynchronously on the thread pool after `deps` have completed, see `thread_pool::async`
+        template <class ThreadPool, int ColumnLanes, class F, class... Deps>
+        auto launch_async(naive_with_threadpool<ThreadPool, ColumnLanes>, F &&f, Deps const &...deps) {
+            return thread_pool::async(ThreadPool(), std::forward<F>(f), deps...);
         }
 
-        template <class ThreadPool>
-        inline auto tmp_allocator(naive_with_threadpool<ThreadPool> be) {
+        template <class ThreadPool, int ColumnLanes>
+        inline auto tmp_allocator(naive_with_threadpool<ThreadPool, ColumnLanes> be) {
             return std::make_tuple(be, sid::allocator(&std::make_unique<char[]>));
         }
 
-        template <class ThreadPool, class Allocator, class Sizes, class T>
-        auto allocate_global_tmp(
-            std::tuple<naive_with_threadpool<ThreadPool>, Allocator> &alloc, Sizes const &sizes, data_type<T>) {
+        template <class ThreadPool, int ColumnLanes, class Allocator, class Sizes, class T>
+        auto allocate_global_tmp(std::tuple<naive_with_threadpool<ThreadPool, ColumnLanes>, Allocator> &alloc,
+            Sizes const &sizes,
+            data_type<T>) {
             return sid::make_contiguous<T, int_t, sid::unknown_kind>(std::get<1>(alloc), sizes);
         }
+
+        // the size of the blocks along the horizontal dimensions for the stages with block temporaries
+        constexpr int block_size = 16;
+
+        /**
+         *  The size of the blocks along `Dim`. The last dimension of the domain, which is the vertical one in the
+         *  cartesian and the unstructured frontends, is not blocked: it is usually short and the halo of the
+         *  temporaries along it would be recomputed by every block.
+         */
+        template <class Dim, class Sizes>
+        int block_extent(Sizes const &sizes) {
+            int size = at_key<Dim>(sizes);
+            if constexpr (!std::is_same_v<Dim, meta::last<get_keys<Sizes>>>)
+                size = std::min(block_size, size);
+            return std::max(size, 1);
+        }
+
+        // block temporaries have an additional dimension for the thread
+        struct thread_dim {};
+
+        // the halo is extended to contain the block itself
+        template <class Extents, class Dim>
+        constexpr int halo_lower = std::min(int(Extents::template lower<Dim>()), 0);
+
+        template <class Extents, class Dim>
+        constexpr int halo_upper = std::max(int(Extents::template upper<Dim>()), 0);
+
+        template <class ThreadPool,
+            int ColumnLanes,
+            class Allocator,
+            class Sizes,
+            class Extents,
+            class T,
+            class... Dims>
+        auto allocate_block_tmp_impl(std::tuple<naive_with_threadpool<ThreadPool, ColumnLanes>, Allocator> &alloc,
+            Sizes const &sizes,
+            Extents,
+            data_type<T>,
+            meta::list<Dims...>) {
+            auto tmp_sizes = hymap::keys<thread_dim, Dims...>::make_values(thread_pool::get_max_threads(ThreadPool()),
+                block_extent<Dims>(sizes) + halo_upper<Extents, Dims> - halo_lower<Extents, Dims>...);
+            // the origin is at the first point of the block
+            auto tmp = sid::make_contiguous<T, int_t, sid::unknown_kind>(std::get<1>(alloc), tmp_sizes);
+            return sid::shift_sid_origin(
+                std::move(tmp), hymap::keys<Dims...>::make_values(-halo_lower<Extents, Dims>...));
+        }
+
+        /**
+         *  Allocates a temporary for a block of each thread, extended by the given extents.
+         */
+        template <class ThreadPool, int ColumnLanes, class Allocator, class Sizes, class Extents, class T>
+        auto allocate_block_tmp(std::tuple<naive_with_threadpool<ThreadPool, ColumnLanes>, Allocator> &alloc,
+            Sizes const &sizes,
+            Extents,
+            data_type<T>) {
+            return allocate_block_tmp_impl(
+                alloc, sizes, Extents(), data_type<T>(), meta::rename<meta::list, get_keys<Sizes>>());
+        }
+
+        // runs the stage at the points of the block extended by the stage extents; like in the stencil frontend the
+        // extended region may cross the domain boundary
+        template <class Stage,
+            class MakeIterator,
+            class Ptr,
+            class Strides,
+            class Start,
+            class Sizes,
+            class BlockSizes,
+            class... Dims>
+        void apply_block_stage(Stage,
+            MakeIterator const &make_iterator,
+            Ptr ptr,
+            Strides const &strides,
+            Start const &start,
+            Sizes const &sizes,
+            BlockSizes const &block_sizes,
+            meta::list<Dims...>) {
+            using extents_t = typename Stage::compute_extents_t;
+            auto region = hymap::keys<Dims...>::make_values(
+                std::min(at_key<Dims>(block_sizes), at_key<Dims>(sizes) - at_key<Dims>(start)) +
+                halo_upper<extents_t, Dims> - halo_lower<extents_t, Dims>...);
+            sid::multi_shift(ptr, strides, hymap::keys<Dims...>::make_values(halo_lower<extents_t, Dims>...));
+            common::make_loops(region)([&](auto &ptr, auto const &strides) { Stage()(make_iterator, ptr, strides); })(
+                ptr, strides);
+        }
+
+        /**
+         *  Executes the `blocked_stencil_stage`s block by block. All stages are applied to a block before the next
+         *  one is processed by the same thread, the block temporaries are redirected to the buffers of the thread.
+         *  Within a block the stages are applied one after another; they are not fused.
+         */
+        template <class ThreadPool,
+            int ColumnLanes,
+            class Sizes,
+            class... Stages,
+            class... Tmps,
+            class MakeIterator,
+            class Composite,
+            class... Dims>
+        void apply_block_stencil_stages_impl(naive_with_threadpool<ThreadPool, ColumnLanes>,
+            Sizes const &sizes,
+            meta::list<Stages...>,
+            meta::list<Tmps...>,
+            MakeIterator &&make_iterator,
+            Composite &&composite,
+            meta::list<Dims...> dims) {
+            using dims_t = hymap::keys<Dims...>;
+            auto origin = sid::get_origin(std::forward<Composite>(composite))();
+            auto strides = sid::get_strides(std::forward<Composite>(composite));
+            auto int_sizes = dims_t::make_values(int(at_key<Dims>(sizes))...);
+            auto block_sizes = dims_t::make_values(block_extent<Dims>(int_sizes)...);
+            auto loop_f = [&, make_iterator = make_iterator()](auto... blocks) {
+                auto start = dims_t::make_values(blocks * at_key<Dims>(block_sizes)...);
+                auto ptr = origin;
+                sid::multi_shift(ptr, strides, start);
+                auto thread = thread_pool::get_thread_num(ThreadPool());
+                (...,
+                    (at_key<Tmps>(ptr) = sid::shifted(
+                         at_key<Tmps>(origin), at_key<Tmps>(sid::get_stride<thread_dim>(strides)), thread)));
+                (..., apply_block_stage(Stages(), make_iterator, ptr, strides, start, int_sizes, block_sizes, dims));
+            };
+            thread_pool::parallel_for_loop(ThreadPool(),
+                loop_f,
+                (at_key<Dims>(int_sizes) + at_key<Dims>(block_sizes) - 1) / at_key<Dims>(block_sizes)...);
+        }
+
+        template <class ThreadPool,
+            int ColumnLanes,
+            class Sizes,
+            class Stages,
+            class Tmps,
+            class MakeIterator,
+            class Composite>
+        void apply_block_stencil_stages(naive_with_threadpool<ThreadPool, ColumnLanes> be,
+            Sizes const &sizes,
+            Stages,
+            Tmps,
+            MakeIterator &&make_iterator,
+            Composite &&composite) {
+            apply_block_stencil_stages_impl(be,
+                sizes,
+                Stages(),
+                Tmps(),
+                std::forward<MakeIterator>(make_iterator),
+                std::forward<Composite>(composite),
+                meta::rename<meta::list, get_keys<Sizes>>());
+        }
     } // namespace naive_impl_
 
     using naive_impl_::naive;
+    using naive_impl_::naive_column_lanes;
     using naive_impl_::naive_with_threadpool;
 
+    using naive_impl_::apply_block_stencil_stages;
     using naive_impl_::apply_column_stage;
     using naive_impl_::apply_stencil_stage;
+    using naive_impl_::launch_async;
 
+    using naive_impl_::allocate_block_tmp;
     using naive_impl_::allocate_global_tmp;
     using naive_impl_::tmp_allocator;
 } // namespace gridtools::fn::backend
@@ -18,7 +18,14 @@
 #include "../common/integral_constant.hpp"
 #include "../common/tuple.hpp"
 #include "../common/tuple_util.hpp"
+#include "../meta/concat.hpp"
+#include "../meta/filter.hpp"
+#include "../meta/is_empty.hpp"
 #include "../meta/is_instantiation_of.hpp"
+#include "../meta/list.hpp"
+#include "../meta/logical.hpp"
+#include "../meta/push_front.hpp"
+#include "../meta/rename.hpp"
 #include "../sid/concept.hpp"
 
 namespace gridtools::fn {
@@ -37,13 +44,292 @@ namespace gridtools::fn {
         struct base : std::bool_constant<IsBackward> {
             static GT_FUNCTION constexpr auto prologue() { return tuple<>(); }
             static GT_FUNCTION constexpr auto epilogue() { return tuple<>(); }
+            using vertical_windows = meta::list<>;
         };
 
         using fwd = base<false>;
         using bwd = base<true>;
 
+        /**
+         *  Declares that the scan/fold reads its input number `Arg` (the position in the argument list of the passes,
+         *  not counting the accumulator) only at the vertical offsets [Lower, Upper] and without other shifts.
+         *  The values of such an input are kept in a window which slides along the column: only one new value is
+         *  loaded per level. Usage:
+         *
+         *  \code
+         *  struct my_scan : fwd {
+         *      using vertical_windows = meta::list<vertical_window<2, -1, 1>>;
+         *      ...
+         *  };
+         *  \endcode
+         *
+         *  The windowed input must not be the output of the same column stage.
+         *
+         *  Only the values within the column are loaded into the window. Unlike a plain input, a windowed input must
+         *  not be read outside of the column (e.g. at k - 1 on the first level) even if the SID has a vertical halo
+         *  there; this is checked by an assertion. Read such an input as a plain one instead.
+         */
+        template <int Arg, int Lower, int Upper>
+        struct vertical_window {
+            static_assert(Lower <= 0 && Upper >= 0);
+            static constexpr int arg = Arg;
+        };
+
+        // `m_first` and `m_last` delimit the loaded values
+        template <class Vertical, class T, int Lower, int Upper>
+        struct window_iterator {
+            T const *m_ptr;
+            T const *m_first;
+            T const *m_last;
+        };
+
+        template <class Vertical, class T, int Lower, int Upper>
+        GT_FUNCTION T const &deref(window_iterator<Vertical, T, Lower, Upper> const &it) {
+            assert(it.m_ptr >= it.m_first && it.m_ptr <= it.m_last);
+            return *it.m_ptr;
+        }
+
+        template <class Vertical, class T, int Lower, int Upper>
+        GT_FUNCTION T const &operator*(window_iterator<Vertical, T, Lower, Upper> const &it) {
+            return deref(it);
+        }
+
+        template <class Vertical, class T, int Lower, int Upper>
+        GT_FUNCTION constexpr bool can_deref(window_iterator<Vertical, T, Lower, Upper> const &) {
+            return true;
+        }
+
+        template <class Vertical>
+        GT_FUNCTION constexpr int vertical_offset() {
+            return 0;
+        }
+
+        template <class Vertical, class Dim, class Offset, class... Offsets>
+        GT_FUNCTION constexpr int vertical_offset(Dim, Offset offset, Offsets... offsets) {
+            static_assert(std::is_same_v<Dim, Vertical>, "only vertical shifts are allowed for windowed inputs");
+            return offset + vertical_offset<Vertical>(offsets...);
+        }
+
+        template <class Vertical, class T, int Lower, int Upper, class... Offsets>
+        GT_FUNCTION window_iterator<Vertical, T, Lower, Upper> shift(
+            window_iterator<Vertical, T, Lower, Upper> const &it, Offsets... offsets) {
+            return {it.m_ptr + vertical_offset<Vertical>(offsets...), it.m_first, it.m_last};
+        }
+
+        struct no_window {
+            template <class Tag, class MakeIterator, class Ptr, class Strides>
+            GT_FUNCTION auto iterator(
+                Tag tag, MakeIterator const &make_iterator, Ptr const &ptr, Strides const &strides) const {
+                return make_iterator(tag, ptr, strides);
+            }
+
+            template <class... Ts>
+            GT_FUNCTION void load(Ts &&...) {}
+
+            template <class... Ts>
+            GT_FUNCTION void advance(Ts &&...) {}
+        };
+
+        template <class Vertical, class T, int Lower, int Upper>
+        struct window {
+            static constexpr int size = Upper - Lower + 1;
+
+            // the values at the levels k + Lower, ..., k + Upper; those outside of the column are never loaded
+            T m_values[size] = {};
+            // the range of the loaded values
+            int m_first = 0;
+            int m_last = size - 1;
+
+            GT_FUNCTION void set_loaded(int k, int column_size) {
+                m_first = k + Lower < 0 ? -k - Lower : 0;
+                m_last = k + Upper >= column_size ? column_size - 1 - k - Lower : size - 1;
+            }
+
+            template <class Tag, class MakeIterator, class Ptr, class Strides>
+            GT_FUNCTION window_iterator<Vertical, T, Lower, Upper> iterator(
+                Tag, MakeIterator const &, Ptr const &, Strides const &) const {
+                return {m_values - Lower, m_values + m_first, m_values + m_last};
+            }
+
+            template <class Tag, class Ptr, class VStride>
+            GT_FUNCTION void load(Tag, Ptr const &ptr, VStride const &v_stride, int k, int column_size) {
+                auto const &p = host_device::at_key<Tag>(ptr);
+                auto const &stride = host_device::at_key<Tag>(v_stride);
+                set_loaded(k, column_size);
+                for (int i = m_first; i <= m_last; ++i)
+                    m_values[i] = *sid::shifted(p, stride, Lower + i);
+            }
+
+            // moves the window by one level, `ptr` and `k` are already moved
+            template <class Step, class Tag, class Ptr, class VStride>
+            GT_FUNCTION void advance(Step, Tag, Ptr const &ptr, VStride const &v_stride, int k, int column_size) {
+                auto const &p = host_device::at_key<Tag>(ptr);
+                auto const &stride = host_device::at_key<Tag>(v_stride);
+                set_loaded(k, column_size);
+                if constexpr (Step::value > 0) {
+                    for (int i = 0; i < size - 1; ++i)
+                        m_values[i] = m_values[i + 1];
+                    if (k + Upper < column_size)
+                        m_values[size - 1] = *sid::shifted(p, stride, integral_constant<int, Upper>());
+                } else {
+                    for (int i = size - 1; i > 0; --i)
+                        m_values[i] = m_values[i - 1];
+                    if (k + Lower >= 0)
+                        m_values[0] = *sid::shifted(p, stride, integral_constant<int, Lower>());
+                }
+            }
+        };
+
+        template <int Arg>
+        struct is_window_of {
+            template <class W>
+            using apply = std::bool_constant<W::arg == Arg>;
+        };
+
+        template <class Vertical, class T, class Found>
+        struct make_window {
+            using type = no_window;
+        };
+
+        template <class Vertical, class T, int Arg, int Lower, int Upper>
+        struct make_window<Vertical, T, meta::list<vertical_window<Arg, Lower, Upper>>> {
+            using type = window<Vertical, T, Lower, Upper>;
+        };
+
+        template <class Vertical, class Windows, class Ptr, int... Ins, std::size_t... Is>
+        GT_FUNCTION auto make_windows(Ptr const &, std::index_sequence<Is...>) {
+            return tuple<typename make_window<Vertical,
+                std::decay_t<decltype(*host_device::at_key<integral_constant<int, Ins>>(std::declval<Ptr const &>()))>,
+                meta::filter<is_window_of<Is>::template apply, Windows>>::type...>();
+        }
+
+        template <class Pass, class Acc, class... Its>
+        auto call_pass(Pass const &pass, Acc &&acc, Its &&...its) {
+            if constexpr (is_scan_pass<Pass>())
+                return pass.m_f(std::forward<Acc>(acc), std::forward<Its>(its)...);
+            else
+                return pass(std::forward<Acc>(acc), std::forward<Its>(its)...);
+        }
+
+        template <class Acc, class... Its>
+        struct keeps_acc_type {
+            template <class Pass>
+            using apply = std::is_same<Acc,
+                std::decay_t<decltype(call_pass(
+                    std::declval<Pass const &>(), std::declval<Acc>(), std::declval<Its>()...))>>;
+        };
+
         template <class Vertical, class ScanOrFold, int Out, int... Ins>
         struct column_stage {
+            template <class Ptr>
+            using windows_tuple_t = decltype(make_windows<Vertical, typename ScanOrFold::vertical_windows, Ptr, Ins...>(
+                std::declval<Ptr const &>(), std::make_index_sequence<sizeof...(Ins)>()));
+
+            template <class MakeIterator, class Ptr, class Strides, class... Windows>
+            static meta::list<decltype(std::declval<Windows const &>().iterator(integral_constant<int, Ins>(),
+                std::declval<MakeIterator const &>(),
+                std::declval<Ptr const &>(),
+                std::declval<Strides const &>()))...>
+            iterator_types(tuple<Windows...> const &);
+
+            using passes_t = meta::concat<meta::rename<meta::list, decltype(ScanOrFold::prologue())>,
+                meta::list<decltype(ScanOrFold::body())>,
+                meta::rename<meta::list, decltype(ScanOrFold::epilogue())>>;
+
+            // the accumulator and the iterators the passes are called with
+            template <class Seed, class MakeIterator, class Ptr, class Strides>
+            using pass_args_t = meta::push_front<
+                decltype(iterator_types<MakeIterator, Ptr, Strides>(std::declval<windows_tuple_t<Ptr>>())),
+                Seed>;
+
+            // `lanes` is applicable if the accumulator type is the same before and after each pass
+            template <class Seed, class MakeIterator, class Ptr, class Strides>
+            static constexpr bool has_lanes = meta::all_of<
+                meta::rename<keeps_acc_type, pass_args_t<Seed, MakeIterator, Ptr, Strides>>::template apply,
+                passes_t>::value;
+
+            /**
+             *  Runs the stage for `n` <= `Lanes` adjacent columns in lock-step: each pass is applied to all columns
+             *  before moving to the next level. The accumulators (and the vertical windows) of the columns are kept
+             *  in arrays, so that the loop over the columns can be vectorized. The columns are `lane_stride` apart.
+             */
+            template <int Lanes, class Seed, class MakeIterator, class Ptr, class Strides, class LaneStride>
+            void lanes(Seed const &seed,
+                std::size_t size,
+                int n,
+                MakeIterator const &make_iterator,
+                Ptr ptr,
+                Strides const &strides,
+                LaneStride const &lane_stride) const {
+                constexpr std::size_t prologue_size = std::tuple_size_v<decltype(ScanOrFold::prologue())>;
+                constexpr std::size_t epilogue_size = std::tuple_size_v<decltype(ScanOrFold::epilogue())>;
+                constexpr bool has_windows = !meta::is_empty<typename ScanOrFold::vertical_windows>::value;
+                assert(size >= prologue_size + epilogue_size);
+                assert(n > 0 && n <= Lanes);
+                using step_t = integral_constant<int, ScanOrFold::value ? -1 : 1>;
+                using tags_t = tuple<integral_constant<int, Ins>...>;
+                auto const &v_stride = sid::get_stride<Vertical>(strides);
+                auto lane_ptr = [&](int l) {
+                    auto p = ptr;
+                    sid::shift(p, lane_stride, l);
+                    return p;
+                };
+                Seed acc[Lanes];
+                windows_tuple_t<Ptr> windows[Lanes];
+                for (int l = 0; l < Lanes; ++l)
+                    acc[l] = seed;
+                int k = ScanOrFold::value ? int(size) - 1 : 0;
+                auto for_each_lane = [&](auto const &f) {
+                    if (n == Lanes) {
+#pragma omp simd
+                        for (int l = 0; l < Lanes; ++l)
+                            f(l);
+                    } else {
+                        for (int l = 0; l < n; ++l)
+                            f(l);
+                    }
+                };
+                auto next = [&](auto const &pass) {
+                    for_each_lane([&](int l) {
+                        auto p = lane_ptr(l);
+                        acc[l] = tuple_util::apply(
+                            [&](auto const &...ws) {
+                                return call_pass(pass,
+                                    std::move(acc[l]),
+                                    ws.iterator(integral_constant<int, Ins>(), make_iterator, p, strides)...);
+                            },
+                            windows[l]);
+                        if constexpr (is_scan_pass<std::decay_t<decltype(pass)>>())
+                            *host_device::at_key<integral_constant<int, Out>>(p) = pass.m_p(acc[l]);
+                    });
+                    sid::shift(ptr, v_stride, step_t());
+                    if constexpr (has_windows) {
+                        k += step_t::value;
+                        for_each_lane([&](int l) {
+                            tuple_util::for_each(
+                                [&, p = lane_ptr(l)](
+                                    auto &window, auto tag) { window.advance(step_t(), tag, p, v_stride, k, size); },
+                                windows[l],
+                                tags_t());
+                        });
+                    }
+                };
+                if constexpr (ScanOrFold::value)
+                    sid::shift(ptr, v_stride, size - 1);
+                if constexpr (has_windows)
+                    for_each_lane([&](int l) {
+                        tuple_util::for_each([&, p = lane_ptr(l)](auto &window,
+                                                 auto tag) { window.load(tag, p, v_stride, k, size); },
+                            windows[l],
+                            tags_t());
+                    });
+                tuple_util::for_each(next, ScanOrFold::prologue());
+                std::size_t levels = size - prologue_size - epilogue_size;
+                for (std::size_t i = 0; i < levels; ++i)
+                    next(ScanOrFold::body());
+                tuple_util::for_each(next, ScanOrFold::epilogue());
+            }
+
             template <class Seed, class MakeIterator, class Ptr, class Strides>
             GT_FUNCTION auto operator()(
                 Seed seed, std::size_t size, MakeIterator &&make_iterator, Ptr ptr, Strides const &strides) const {
@@ -53,19 +339,41 @@ namespace gridtools::fn {
                 assert(size >= prologue_size + epilogue_size);
                 GT_NVCC_DIAG_POP_SUPPRESS(186)
                 using step_t = integral_constant<int, ScanOrFold::value ? -1 : 1>;
+                using windows_t = typename ScanOrFold::vertical_windows;
+                static_assert(meta::is_empty<windows_t>::value || ((Ins != Out) && ...),
+                    "vertical windows are not supported for the column stages which read their output");
                 auto const &v_stride = sid::get_stride<Vertical>(strides);
-                auto inc = [&] { sid::shift(ptr, v_stride, step_t()); };
+                auto windows = make_windows<Vertical, windows_t, Ptr, Ins...>(
+                    ptr, std::make_index_sequence<sizeof...(Ins)>());
+                int k = ScanOrFold::value ? int(size) - 1 : 0;
+                auto inc = [&] {
+                    sid::shift(ptr, v_stride, step_t());
+                    if constexpr (!meta::is_empty<windows_t>::value) {
+                        k += step_t::value;
+                        tuple_util::host_device::for_each(
+                            [&](auto &window, auto tag) { window.advance(step_t(), tag, ptr, v_stride, k, size); },
+                            windows,
+                            tuple<integral_constant<int, Ins>...>());
+                    }
+                };
+                auto iterators = [&](auto const &f, auto acc) {
+                    return tuple_util::host_device::apply(
+                        [&](auto const &...ws) {
+                            return f(std::move(acc),
+                                ws.iterator(integral_constant<int, Ins>(), make_iterator, ptr, strides)...);
+                        },
+                        windows);
+                };
                 auto next = [&](auto acc, auto pass) {
                     if constexpr (is_scan_pass<decltype(pass)>()) {
                         // scan
-                        auto res =
-                            pass.m_f(std::move(acc), make_iterator(integral_constant<int, Ins>(), ptr, strides)...);
+                        auto res = iterators(pass.m_f, std::move(acc));
                         *host_device::at_key<integral_constant<int, Out>>(ptr) = pass.m_p(res);
                         inc();
                         return res;
                     } else {
                         // fold
-                        auto res = pass(std::move(acc), make_iterator(integral_constant<int, Ins>(), ptr, strides)...);
+                        auto res = iterators(pass, std::move(acc));
                         inc();
                         return res;
                     }
@@ -75,6 +383,11 @@ namespace gridtools::fn {
                 GT_NVCC_DIAG_POP_SUPPRESS(940)
                 if constexpr (ScanOrFold::value)
                     sid::shift(ptr, v_stride, size - 1);
+                if constexpr (!meta::is_empty<windows_t>::value)
+                    tuple_util::host_device::for_each(
+                        [&](auto &window, auto tag) { window.load(tag, ptr, v_stride, k, size); },
+                        windows,
+                        tuple<integral_constant<int, Ins>...>());
                 auto acc = tuple_util::host_device::fold(next, std::move(seed), ScanOrFold::prologue());
                 std::size_t n = size - prologue_size - epilogue_size;
                 for (std::size_t i = 0; i < n; ++i)
@@ -102,6 +415,7 @@ namespace gridtools::fn {
     using column_stage_impl_::column_stage;
     using column_stage_impl_::fwd;
     using column_stage_impl_::merged_column_stage;
+    using column_stage_impl_::vertical_window;
 
 #if GT_NVCC_WORKAROUND_1766
     template <class F, class Projector = host_device::identity>
@@ -0,0 +1,105 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../common/array.hpp"
+#include "../common/defs.hpp"
+#include "../common/host_device.hpp"
+#include "../common/integral_constant.hpp"
+#include "../common/tuple_util.hpp"
+#include "./neighbor_table.hpp"
+
+/**
+ *   Compressed sparse row neighbor table for meshes with variable valence: the neighbors of the location `i` are
+ *   `targets[offsets[i]]` ... `targets[offsets[i + 1] - 1]`.
+ *
+ *   Only the existing neighbors are stored, so the table doesn't carry the padding of the fixed size layouts. The
+ *   neighbor lists are still presented as tuples of `MaxNumNeighbors` elements padded with -1, as the neighbor table
+ *   concept requires, but the padding is not read from memory.
+ *
+ *   The index type `T` of the targets could be narrower than `int` (f.e. `std::int16_t` for the local indices of a
+ *   partitioned mesh).
+ */
+namespace gridtools::fn::csr_neighbor_table {
+    namespace csr_neighbor_table_impl_ {
+        template <class T, std::size_t MaxNumNeighbors>
+        struct csr_neighbor_table {
+            int const *offsets;
+            T const *targets;
+        };
+
+        template <class T, std::size_t MaxNumNeighbors>
+        GT_FUNCTION array<int, MaxNumNeighbors> neighbor_table_neighbors(
+            csr_neighbor_table<T, MaxNumNeighbors> const &table, int index) {
+            int first = table.offsets[index];
+            int size = table.offsets[index + 1] - first;
+            array<int, MaxNumNeighbors> res;
+            for (int n = 0; n != int(MaxNumNeighbors); ++n)
+                res[n] = n < size ? int(table.targets[first + n]) : -1;
+            return res;
+        }
+
+        template <class T, std::size_t MaxNumNeighbors, int I>
+        GT_FUNCTION int neighbor_table_neighbor(
+            csr_neighbor_table<T, MaxNumNeighbors> const &table, int index, integral_constant<int, I>) {
+            static_assert(I >= 0 && std::size_t(I) < MaxNumNeighbors);
+            int pos = table.offsets[index] + I;
+            return pos < table.offsets[index + 1] ? int(table.targets[pos]) : -1;
+        }
+
+        template <std::size_t MaxNumNeighbors, class T>
+        csr_neighbor_table<T, MaxNumNeighbors> as_neighbor_table(int const *offsets, T const *targets) {
+            static_assert(std::is_integral_v<T>, "CSR neighbor table needs integral indices");
+            return {offsets, targets};
+        }
+
+        template <class T>
+        struct data {
+            std::vector<int> offsets;
+            std::vector<T> targets;
+        };
+
+        /**
+         *  Converts the first `n` entries of any neighbor table accessible on the host into the CSR layout. The skip
+         *  values are dropped; the order of the remaining neighbors is kept, but they move to the front of the list.
+         *  Throws if some index doesn't fit into `T`.
+         */
+        template <class T = int, class Table>
+        data<T> make_data(Table const &table, int n) {
+            data<T> res;
+            res.offsets.reserve(n + 1);
+            res.offsets.push_back(0);
+            for (int i = 0; i != n; ++i) {
+                tuple_util::for_each(
+                    [&](auto neighbor) {
+                        if (neighbor == -1)
+                            return;
+                        if (neighbor < std::numeric_limits<T>::min() || neighbor > std::numeric_limits<T>::max())
+                            throw std::out_of_range("csr_neighbor_table: the index " + std::to_string(neighbor) +
+                                                    " doesn't fit into the index type");
+                        res.targets.push_back(T(neighbor));
+                    },
+                    neighbor_table::neighbors(table, i));
+                res.offsets.push_back(res.targets.size());
+            }
+            return res;
+        }
+    } // namespace csr_neighbor_table_impl_
+
+    using csr_neighbor_table_impl_::as_neighbor_table;
+    using csr_neighbor_table_impl_::make_data;
+} // namespace gridtools::fn::csr_neighbor_table
@@ -10,16 +10,77 @@
 #pragma once
 
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "../common/tuple_util.hpp"
 #include "../meta.hpp"
+#include "../sid/concept.hpp"
+#include "../sid/multi_shift.hpp"
 #include "../sid/sid_shift_origin.hpp"
+#include "../sid/synthetic.hpp"
 #include "./column_stage.hpp"
 #include "./run.hpp"
 #include "./stencil_stage.hpp"
 
 namespace gridtools::fn {
     namespace executor_impl_ {
+        /**
+         *  An executor prepared for repeated execution.
+         *
+         *  The temporaries are allocated, and the composite of the arguments with its origin and strides is computed
+         *  only once. `execute` can rebind the arguments, which were passed by the user with `arg`, to other SIDs of
+         *  the same strides kinds; only their origins are computed then. SIDs of `unknown_kind` are accepted as well,
+         *  but then they should have the same strides as the ones used for preparation.
+         */
+        template <class Run, class Alloc, class Composite, class Positions, class Diffs, class StridesKinds>
+        class prepared_executor {
+            Run m_run;
+            Alloc m_alloc;
+            Composite m_composite;
+            sid::ptr_holder_type<Composite> m_origin;
+            sid::strides_type<Composite> m_strides;
+            Diffs m_diffs;
+
+            template <class Origin, size_t... Is, class... Sids>
+            void rebind(Origin &origin, std::index_sequence<Is...>, Sids &&...sids) const {
+                (...,
+                    (tuple_util::get<meta::at_c<Positions, Is>::value>(origin) =
+                            sid::get_origin(sids) + tuple_util::get<Is>(m_diffs)));
+            }
+
+          public:
+            prepared_executor(Run run, Alloc alloc, Composite composite, Diffs diffs)
+                : m_run(std::move(run)), m_alloc(std::move(alloc)), m_composite(std::move(composite)),
+                  m_origin(sid::get_origin(m_composite)), m_strides(sid::get_strides(m_composite)),
+                  m_diffs(std::move(diffs)) {}
+
+            prepared_executor(prepared_executor &&) = default;
+            prepared_executor &operator=(prepared_executor &&) = default;
+
+            /**
+             *  Executes with the arguments of the preparation if called without arguments, otherwise with the
+             *  given ones in place of those passed with `arg`.
+             */
+            template <class... Sids>
+            void execute(Sids &&...sids) const {
+                static_assert(sizeof...(Sids) == 0 || sizeof...(Sids) == meta::length<Positions>::value,
+                    "The number of the arguments differs from the prepared one.");
+                auto origin = m_origin;
+                if constexpr (sizeof...(Sids) != 0) {
+                    using kinds_t = meta::list<sid::strides_kind<std::remove_reference_t<Sids>>...>;
+                    static_assert(std::is_same_v<kinds_t, StridesKinds>,
+                        "The arguments should be of the same strides kinds as the prepared ones.");
+                    rebind(origin, std::index_sequence_for<Sids...>(), sids...);
+                }
+                m_run(sid::synthetic()
+                          .template set<sid::property::origin>(std::move(origin))
+                          .template set<sid::property::strides>(m_strides)
+                          .template set<sid::property::ptr_diff, sid::ptr_diff_type<Composite>>()
+                          .template set<sid::property::strides_kind, sid::unknown_kind>());
+            }
+        };
+
         template <class Backend,
             int ArgOffset,
             class Sizes,
@@ -48,6 +109,51 @@ namespace gridtools::fn {
                     std::move(args)};
             }
 
+            template <class T>
+            auto block_tmp() && {
+                auto args = tuple_util::deep_copy(tuple_util::push_back(std::move(m_args), block_tmp_arg<T>()));
+                return executor_data<Backend, ArgOffset, Sizes, Offsets, MakeIterator, decltype(args), Specs>{
+                    std::move(m_backend),
+                    std::move(m_sizes),
+                    std::move(m_offsets),
+                    std::move(m_make_iterator),
+                    std::move(args)};
+            }
+
+            // the positions of the arguments passed by the user with `arg`
+            template <class I>
+            using is_user_arg =
+                std::bool_constant<I::value >= ArgOffset && !meta::st_contains<block_tmp_positions<Args>, I>::value>;
+            using positions_t = meta::
+                iseq_to_list<std::make_integer_sequence<int, std::tuple_size_v<Args>>, meta::list, integral_constant>;
+            using user_positions_t = meta::filter<is_user_arg, positions_t>;
+
+            // the shifts of the origins by the domain offsets
+            template <class... Is>
+            auto origin_diffs(meta::list<Is...>) const {
+                return std::make_tuple(sid::multi_shifted(sid::ptr_diff_type<std::tuple_element_t<Is::value, Args>>(),
+                    sid::get_strides(std::get<Is::value>(m_args)),
+                    m_offsets)...);
+            }
+
+            template <class... Is>
+            static meta::list<sid::strides_kind<std::tuple_element_t<Is::value, Args>>...> strides_kinds(
+                meta::list<Is...>);
+
+            template <class StageSpecs, class Run>
+            auto prepare(Run run) && {
+                auto diffs = origin_diffs(user_positions_t());
+                auto alloc = tmp_allocator(m_backend);
+                auto composite = make_composite(make_tmps<StageSpecs>(m_backend, alloc, m_sizes, std::move(m_args)));
+                return prepared_executor<Run,
+                    decltype(alloc),
+                    decltype(composite),
+                    user_positions_t,
+                    decltype(diffs),
+                    decltype(strides_kinds(user_positions_t()))>(
+                    std::move(run), std::move(alloc), std::move(composite), std::move(diffs));
+            }
+
             template <class Spec>
             auto spec(Spec) && {
                 using specs_t = meta::push_back<Specs, Spec>;
@@ -60,6 +166,19 @@ namespace gridtools::fn {
             }
         };
 
+        // executes asynchronously on the backend after `deps` have completed; `get` rethrows their exceptions
+        template <class Executor, class... Deps>
+        auto launch_execution(Executor executor, Deps const &...deps) {
+            auto backend = executor.m_data.m_backend;
+            return launch_async(
+                backend,
+                [executor = std::move(executor), deps...]() mutable {
+                    (..., deps.get());
+                    std::move(executor).execute();
+                },
+                deps...);
+        }
+
         template <class Data>
         struct stencil_executor {
             Data m_data;
@@ -70,6 +189,19 @@ namespace gridtools::fn {
                 return stencil_executor<decltype(data)>{std::move(data)};
             }
 
+            /**
+             *  Adds a temporary of the type `T` as the next argument. It exists only within `execute`: where the
+             *  backend supports it, the domain is processed in blocks and the temporary is allocated per thread
+             *  for a block plus the halo which the later stages access (see `block_stencil_stages`), otherwise a
+             *  global temporary is allocated. The stencils reading or writing it must declare their extents. The
+             *  stages are not fused when the domain is processed in blocks.
+             */
+            template <class T>
+            auto block_tmp() && {
+                auto data = std::move(m_data).template block_tmp<T>();
+                return stencil_executor<decltype(data)>{std::move(data)};
+            }
+
             template <class Out, class Stencil, class... Ins>
             auto assign(Out, Stencil, Ins...) && {
                 auto data = std::move(m_data).spec(stencil_stage<Stencil,
@@ -78,12 +210,43 @@ namespace gridtools::fn {
                 return stencil_executor<decltype(data)>{std::move(data)};
             }
 
+            // consecutive stages of `pointwise` stencils are fused into a single sweep over the domain
             void execute() && {
-                run_stencil_stages(std::move(m_data.m_backend),
-                    typename Data::specs_t(),
-                    std::move(m_data.m_make_iterator),
-                    std::move(m_data.m_sizes),
-                    std::move(m_data.m_args));
+                if constexpr (meta::is_empty<block_tmp_positions<decltype(m_data.m_args)>>::value)
+                    run_stencil_stages(std::move(m_data.m_backend),
+                        fuse_stencil_stages<typename Data::specs_t>(),
+                        std::move(m_data.m_make_iterator),
+                        std::move(m_data.m_sizes),
+                        std::move(m_data.m_args));
+                else
+                    run_stencil_stages_with_block_tmps(std::move(m_data.m_backend),
+                        typename Data::specs_t(),
+                        std::move(m_data.m_make_iterator),
+                        std::move(m_data.m_sizes),
+                        std::move(m_data.m_args));
+            }
+
+            /**
+             *  Starts `execute` once all `deps`, the completion handles of the earlier asynchronous executions, have
+             *  completed, and returns its own completion handle. The arguments should stay alive and untouched until
+             *  then. Only supported by the backends providing `launch_async`. Whether the call returns without
+             *  waiting depends on the thread pool of the backend: the pools which can't run tasks asynchronously
+             *  (e.g. `thread_pool::dummy`) wait for `deps`, execute right away and return a ready handle.
+             */
+            template <class... Deps>
+            auto execute_async(Deps const &...deps) && {
+                return launch_execution(std::move(*this), deps...);
+            }
+
+            auto prepare() && {
+                using specs_t = typename Data::specs_t;
+                using tmps_t = block_tmp_positions<decltype(m_data.m_args)>;
+                auto run = [backend = m_data.m_backend,
+                               make_iterator = m_data.m_make_iterator,
+                               sizes = m_data.m_sizes](auto const &composite) {
+                    run_stencil_stages_on(backend, specs_t(), tmps_t(), make_iterator, sizes, composite);
+                };
+                return std::move(m_data).template prepare<specs_t>(std::move(run));
             }
         };
 
@@ -117,6 +280,23 @@ namespace gridtools::fn {
                     std::move(m_data.m_args),
                     std::move(m_seeds));
             }
+
+            // see `stencil_executor::execute_async`
+            template <class... Deps>
+            auto execute_async(Deps const &...deps) && {
+                return launch_execution(std::move(*this), deps...);
+            }
+
+            auto prepare() && {
+                using specs_t = typename Data::specs_t;
+                auto run = [backend = m_data.m_backend,
+                               make_iterator = m_data.m_make_iterator,
+                               sizes = m_data.m_sizes,
+                               seeds = std::move(m_seeds)](auto const &composite) {
+                    run_column_stages_on(backend, specs_t(), make_iterator, sizes, Vertical(), composite, seeds);
+                };
+                return std::move(m_data).template prepare<specs_t>(std::move(run));
+            }
         };
 
         // ArgOffset allows passing some args for backend usage while keeping them hidden from the user
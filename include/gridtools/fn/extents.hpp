@@ -70,6 +70,19 @@ namespace gridtools {
                 return int_vector::prune_zeros(typename keys_t::template values<typename Ts::size_t...>());
             }
             using sizes_t = decltype(sizes());
+
+            // the lower and the upper extent along `Dim`, zero if `Dim` is not present
+            template <class Dim>
+            static GT_CONSTEVAL GT_FUNCTION std::ptrdiff_t lower() {
+                return ((std::is_same_v<Dim, typename Ts::dim_t> ? Ts::lower_t::value : 0) + ... + 0);
+            }
+
+            template <class Dim>
+            static GT_CONSTEVAL GT_FUNCTION std::ptrdiff_t upper() {
+                return ((std::is_same_v<Dim, typename Ts::dim_t> ? Ts::upper_t::value : 0) + ... + 0);
+            }
+
+            static constexpr bool is_zero = ((Ts::lower_t::value == 0 && Ts::upper_t::value == 0) && ...);
         };
 
         template <class, class = void>
@@ -109,6 +122,24 @@ namespace gridtools {
             struct merge_extents<meta::list<Dim, extent<Dim, L, U>>...> {
                 using type = meta::list<Dim, extent<Dim, std::min({L...}), std::max({U...})>>;
             };
+
+            template <class A, class B, class Dims>
+            struct add_extents;
+
+            template <class A, class B, class... Dims>
+            struct add_extents<A, B, meta::list<Dims...>> {
+                using type = extents<extent<Dims,
+                    A::template lower<Dims>() + B::template lower<Dims>(),
+                    A::template upper<Dims>() + B::template upper<Dims>()>...>;
+            };
+
+            template <class A, class B>
+            struct union_dims;
+
+            template <class... As, class... Bs>
+            struct union_dims<extents<As...>, extents<Bs...>> {
+                using type = meta::dedup<meta::list<typename As::dim_t..., typename Bs::dim_t...>>;
+            };
         } // namespace extent_impl_
 
         // T any number of individual `extent`s and produce the normalized `extents`.
@@ -123,5 +154,11 @@ namespace gridtools {
         template <class... Extentss>
         using enclosing_extents = meta::rename<make_extents, meta::concat<meta::rename<meta::list, Extentss>...>>;
 
+        // The extents of an access with `B` from all points of `A`. The missing dimensions are treated as zero
+        // extents.
+        template <class A, class B>
+        using add_extents =
+            typename extent_impl_::add_extents<A, B, typename extent_impl_::union_dims<A, B>::type>::type;
+
     } // namespace fn
 } // namespace gridtools
@@ -0,0 +1,317 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../common/array.hpp"
+#include "../common/tuple_util.hpp"
+#include "../sid/concept.hpp"
+#include "./neighbor_table.hpp"
+#include "./unstructured.hpp"
+
+/**
+ *   Host side utilities to renumber the locations of an unstructured mesh for better memory locality.
+ *
+ *   The horizontal index of the unstructured domain is iterated in order, hence the neighbor accesses through the
+ *   connectivity tables are only as local as the numbering of the mesh. Meshes read from files are often numbered
+ *   arbitrarily. The typical use:
+ *   \code
+ *   using namespace mesh_reordering;
+ *   // order the vertices by RCM on the vertex graph (vertices sharing an edge are adjacent)...
+ *   auto v_perm = reverse_cuthill_mckee(nvertices, v2e_table, e2v_table);
+ *   // ...and the edges following their vertices
+ *   auto e_perm = induced_permutation(nedges, e2v_table, v_perm);
+ *   auto v2e = renumber(v2e_table, v_perm, e_perm);
+ *   auto e2v = renumber(e2v_table, e_perm, v_perm);
+ *   permute(v_perm, in, in_reordered, nlevels);
+ *   ... // run the stencils on the renumbered mesh
+ *   unpermute(v_perm, out_reordered, out, nlevels);
+ *   \endcode
+ *
+ *   Tables are any models of the neighbor table concept accessible on the host. Fields are SIDs accessible on the host
+ *   with the `unstructured::dim::horizontal` and optionally `unstructured::dim::vertical` dimensions.
+ */
+
+namespace gridtools::fn::mesh_reordering {
+    namespace mesh_reordering_impl_ {
+        /**
+         *  A renumbering of `size()` locations: the location `new_to_old(i)` of the original mesh becomes the location
+         *  `i` of the renumbered one.
+         */
+        class permutation {
+            std::vector<int> m_new_to_old;
+            std::vector<int> m_old_to_new;
+
+          public:
+            permutation() = default;
+
+            explicit permutation(std::vector<int> new_to_old)
+                : m_new_to_old(std::move(new_to_old)), m_old_to_new(m_new_to_old.size(), -1) {
+                for (int i = 0; i != size(); ++i) {
+                    int old = m_new_to_old[i];
+                    if (old < 0 || old >= size() || m_old_to_new[old] != -1)
+                        throw std::invalid_argument("mesh_reordering::permutation: not a permutation");
+                    m_old_to_new[old] = i;
+                }
+            }
+
+            static permutation identity(int size) {
+                std::vector<int> res(size);
+                std::iota(res.begin(), res.end(), 0);
+                return permutation(std::move(res));
+            }
+
+            int size() const { return m_new_to_old.size(); }
+            int new_to_old(int i) const { return m_new_to_old[i]; }
+            int old_to_new(int i) const { return m_old_to_new[i]; }
+            std::vector<int> const &new_to_old() const { return m_new_to_old; }
+            std::vector<int> const &old_to_new() const { return m_old_to_new; }
+
+            permutation inverse() const { return permutation(m_old_to_new); }
+        };
+
+        // the renumbering by `first` followed by the renumbering by `second`
+        inline permutation compose(permutation const &first, permutation const &second) {
+            if (first.size() != second.size())
+                throw std::invalid_argument("mesh_reordering::compose: size mismatch");
+            std::vector<int> res(first.size());
+            for (int i = 0; i != first.size(); ++i)
+                res[i] = first.new_to_old(second.new_to_old(i));
+            return permutation(std::move(res));
+        }
+
+        template <class Table, class Fun>
+        void for_each_neighbor(Table const &table, int index, Fun &&fun) {
+            auto &&neighbors = neighbor_table::neighbors(table, index);
+            tuple_util::for_each(
+                [&](auto neighbor) {
+                    if (neighbor != -1)
+                        fun(int(neighbor));
+                },
+                neighbors);
+        }
+
+        // adjacency lists in the compressed row format
+        struct graph {
+            std::vector<int> m_offsets;
+            std::vector<int> m_targets;
+
+            int size() const { return m_offsets.size() - 1; }
+            int degree(int i) const { return m_offsets[i + 1] - m_offsets[i]; }
+            int const *begin(int i) const { return m_targets.data() + m_offsets[i]; }
+            int const *end(int i) const { return m_targets.data() + m_offsets[i + 1]; }
+        };
+
+        // `neighbors(i, fun)` calls `fun(j)` for all neighbors `j` of `i`; duplicates and self loops are dropped
+        template <class Neighbors>
+        graph make_graph(int n, Neighbors &&neighbors) {
+            graph res;
+            res.m_offsets.reserve(n + 1);
+            res.m_offsets.push_back(0);
+            std::vector<int> row;
+            for (int i = 0; i != n; ++i) {
+                row.clear();
+                neighbors(i, [&](int j) {
+                    if (j != i)
+                        row.push_back(j);
+                });
+                std::sort(row.begin(), row.end());
+                row.erase(std::unique(row.begin(), row.end()), row.end());
+                res.m_targets.insert(res.m_targets.end(), row.begin(), row.end());
+                res.m_offsets.push_back(res.m_targets.size());
+            }
+            return res;
+        }
+
+        inline permutation reverse_cuthill_mckee(graph const &g) {
+            int n = g.size();
+            std::vector<int> order;
+            order.reserve(n);
+            std::vector<bool> visited(n);
+            std::vector<int> by_degree(n);
+            std::iota(by_degree.begin(), by_degree.end(), 0);
+            std::stable_sort(
+                by_degree.begin(), by_degree.end(), [&](int l, int r) { return g.degree(l) < g.degree(r); });
+            std::vector<int> next;
+            // every connected component is started from its unvisited location of the minimal degree
+            for (int start : by_degree) {
+                if (visited[start])
+                    continue;
+                visited[start] = true;
+                order.push_back(start);
+                for (size_t head = order.size() - 1; head != order.size(); ++head) {
+                    int cur = order[head];
+                    next.clear();
+                    for (auto it = g.begin(cur); it != g.end(cur); ++it)
+                        if (!visited[*it]) {
+                            visited[*it] = true;
+                            next.push_back(*it);
+                        }
+                    std::stable_sort(next.begin(), next.end(), [&](int l, int r) { return g.degree(l) < g.degree(r); });
+                    order.insert(order.end(), next.begin(), next.end());
+                }
+            }
+            std::reverse(order.begin(), order.end());
+            return permutation(std::move(order));
+        }
+
+        /**
+         *  Reverse Cuthill-McKee ordering of `n` locations, `table` connects the locations to the locations of the
+         *  same type (f.e. `v2v`).
+         */
+        template <class Table>
+        permutation reverse_cuthill_mckee(int n, Table const &table) {
+            return reverse_cuthill_mckee(
+                make_graph(n, [&](int i, auto &&fun) { for_each_neighbor(table, i, fun); }));
+        }
+
+        /**
+         *  Reverse Cuthill-McKee ordering of `n` locations of type A. Two locations are adjacent if they share a
+         *  neighbor of type B (f.e. `v2e` and `e2v` make the vertices adjacent if they share an edge).
+         */
+        template <class A2B, class B2A>
+        permutation reverse_cuthill_mckee(int n, A2B const &a2b, B2A const &b2a) {
+            return reverse_cuthill_mckee(make_graph(n, [&](int i, auto &&fun) {
+                for_each_neighbor(a2b, i, [&](int b) { for_each_neighbor(b2a, b, fun); });
+            }));
+        }
+
+        /**
+         *  Orders `n` locations of type B by the smallest new index of their neighbors of type A, which are already
+         *  ordered by `a_perm`. The ties keep the original order; the locations without neighbors go last.
+         */
+        template <class B2A>
+        permutation induced_permutation(int n, B2A const &b2a, permutation const &a_perm) {
+            std::vector<int> keys(n, std::numeric_limits<int>::max());
+            for (int i = 0; i != n; ++i)
+                for_each_neighbor(b2a, i, [&](int a) { keys[i] = std::min(keys[i], a_perm.old_to_new(a)); });
+            std::vector<int> res(n);
+            std::iota(res.begin(), res.end(), 0);
+            std::stable_sort(res.begin(), res.end(), [&](int l, int r) { return keys[l] < keys[r]; });
+            return permutation(std::move(res));
+        }
+
+        // the index of the point on the Hilbert curve of the given order
+        inline std::uint64_t hilbert_index(std::uint32_t x, std::uint32_t y, int order) {
+            std::uint64_t res = 0;
+            for (std::uint32_t s = std::uint32_t(1) << (order - 1); s; s /= 2) {
+                std::uint32_t rx = (x & s) != 0;
+                std::uint32_t ry = (y & s) != 0;
+                res += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+                if (!ry) {
+                    if (rx) {
+                        x = s - 1 - x;
+                        y = s - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+            }
+            return res;
+        }
+
+        /**
+         *  Orders `n` locations along the Hilbert curve through their coordinates; `coords(i)` returns a tuple-like
+         *  of two coordinates of the location `i`. Unlike the RCM ordering it needs the geometry, but it gives good
+         *  locality in all directions.
+         */
+        template <class Coords>
+        permutation space_filling_curve(int n, Coords &&coords) {
+            constexpr int order = 16;
+            std::vector<double> xs(n), ys(n);
+            for (int i = 0; i != n; ++i) {
+                auto &&c = coords(i);
+                xs[i] = tuple_util::get<0>(c);
+                ys[i] = tuple_util::get<1>(c);
+            }
+            std::vector<int> res(n);
+            std::iota(res.begin(), res.end(), 0);
+            if (!n)
+                return permutation(std::move(res));
+            auto [x_min, x_max] = std::minmax_element(xs.begin(), xs.end());
+            auto [y_min, y_max] = std::minmax_element(ys.begin(), ys.end());
+            double x0 = *x_min, y0 = *y_min;
+            double scale = ((1 << order) - 1) / std::max({*x_max - x0, *y_max - y0, 1e-300});
+            std::vector<std::uint64_t> keys(n);
+            for (int i = 0; i != n; ++i)
+                keys[i] = hilbert_index(
+                    std::uint32_t((xs[i] - x0) * scale), std::uint32_t((ys[i] - y0) * scale), order);
+            std::stable_sort(res.begin(), res.end(), [&](int l, int r) { return keys[l] < keys[r]; });
+            return permutation(std::move(res));
+        }
+
+        /**
+         *  The A to B connectivity of the renumbered mesh as a vector of neighbor lists; `vector::data()` models the
+         *  neighbor table concept. The order of the neighbors within a list is kept.
+         */
+        template <class A2B>
+        auto renumber(A2B const &a2b, permutation const &a_perm, permutation const &b_perm) {
+            using list_t = std::decay_t<decltype(neighbor_table::neighbors(a2b, 0))>;
+            constexpr size_t size = tuple_util::size<list_t>::value;
+            std::vector<array<int, size>> res(a_perm.size());
+            for (int i = 0; i != a_perm.size(); ++i) {
+                auto &&neighbors = neighbor_table::neighbors(a2b, a_perm.new_to_old(i));
+                size_t n = 0;
+                tuple_util::for_each(
+                    [&](auto neighbor) { res[i][n++] = neighbor == -1 ? -1 : b_perm.old_to_new(neighbor); },
+                    neighbors);
+            }
+            return res;
+        }
+
+        template <class Src, class Dst, class SrcIndex, class DstIndex>
+        void copy_locations(int n, int nlevels, Src const &src, Dst &dst, SrcIndex src_index, DstIndex dst_index) {
+            namespace dim = unstructured::dim;
+            auto src_origin = sid::get_origin(src);
+            auto dst_origin = sid::get_origin(dst);
+            auto src_strides = sid::get_strides(src);
+            auto dst_strides = sid::get_strides(dst);
+            for (int i = 0; i != n; ++i) {
+                auto src_ptr = sid::shifted(src_origin(), sid::get_stride<dim::horizontal>(src_strides), src_index(i));
+                auto dst_ptr = sid::shifted(dst_origin(), sid::get_stride<dim::horizontal>(dst_strides), dst_index(i));
+                for (int k = 0; k != nlevels; ++k) {
+                    *dst_ptr = *src_ptr;
+                    sid::shift(src_ptr, sid::get_stride<dim::vertical>(src_strides), integral_constant<int, 1>());
+                    sid::shift(dst_ptr, sid::get_stride<dim::vertical>(dst_strides), integral_constant<int, 1>());
+                }
+            }
+        }
+
+        // `dst` becomes the renumbered `src`: `dst[i] = src[perm.new_to_old(i)]`
+        template <class Src, class Dst>
+        void permute(permutation const &perm, Src const &src, Dst &&dst, int nlevels = 1) {
+            copy_locations(
+                perm.size(), nlevels, src, dst, [&](int i) { return perm.new_to_old(i); }, [](int i) { return i; });
+        }
+
+        // undoes the renumbering: `dst[perm.new_to_old(i)] = src[i]`
+        template <class Src, class Dst>
+        void unpermute(permutation const &perm, Src const &src, Dst &&dst, int nlevels = 1) {
+            copy_locations(
+                perm.size(), nlevels, src, dst, [](int i) { return i; }, [&](int i) { return perm.new_to_old(i); });
+        }
+    } // namespace mesh_reordering_impl_
+
+    using mesh_reordering_impl_::compose;
+    using mesh_reordering_impl_::induced_permutation;
+    using mesh_reordering_impl_::permutation;
+    using mesh_reordering_impl_::permute;
+    using mesh_reordering_impl_::renumber;
+    using mesh_reordering_impl_::reverse_cuthill_mckee;
+    using mesh_reordering_impl_::space_filling_curve;
+    using mesh_reordering_impl_::unpermute;
+} // namespace gridtools::fn::mesh_reordering
@@ -11,6 +11,7 @@
 
 #include <type_traits>
 
+#include "../common/integral_constant.hpp"
 #include "../common/tuple_util.hpp"
 #include "../meta/logical.hpp"
 
@@ -27,6 +28,11 @@
  *
  *   Pure functional behavior without side-effects is expected from the provided function.
  *
+ *   Optionally, a single neighbor could be provided by:
+ *     `Neighbor neighbor_table_neighbor(T const&, int index, integral_constant<int, I>);`
+ *   It should be equivalent to `get<I>(neighbor_table_neighbors(table, index))`, which is the default. Table layouts
+ *   that can read one neighbor cheaper than the whole list (like the neighbor-major ones) should provide it.
+ *
  *   Compile-time API
  *   ================
  *
@@ -38,6 +44,7 @@
  *   Wrapper for the concept function:
  *
  *   `Neighbors neighbor_table::neighbors(NeighborTable const&, int);`
+ *   `Neighbor neighbor_table::neighbor<I>(NeighborTable const&, int);`
  *
  *   Default Implementation
  *   ======================
@@ -65,6 +72,17 @@ namespace gridtools::fn::neighbor_table {
             return neighbor_table_neighbors(nt, index);
         }
 
+        template <class NeighborTable, int I>
+        GT_FUNCTION constexpr auto neighbor_table_neighbor(
+            NeighborTable const &nt, int index, integral_constant<int, I>) {
+            return tuple_util::host_device::get<I>(neighbor_table_neighbors(nt, index));
+        }
+
+        template <int I, class NeighborTable>
+        GT_FUNCTION constexpr auto neighbor(NeighborTable const &nt, int index) {
+            return neighbor_table_neighbor(nt, index, integral_constant<int, I>());
+        }
+
         template <class T>
         using neighbor_list_type = std::remove_cv_t<std::remove_reference_t<
             decltype(::gridtools::fn::neighbor_table::neighbor_table_impl_::neighbors(std::declval<T const &>(), 0))>>;
@@ -79,6 +97,7 @@ namespace gridtools::fn::neighbor_table {
     } // namespace neighbor_table_impl_
 
     using neighbor_table_impl_::is_neighbor_table;
+    using neighbor_table_impl_::neighbor;
     using neighbor_table_impl_::neighbors;
 
 } // namespace gridtools::fn::neighbor_table
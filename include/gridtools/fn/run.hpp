@@ -9,13 +9,73 @@
  */
 #pragma once
 
+#include <type_traits>
+#include <utility>
+
 #include "../common/tuple_util.hpp"
 #include "../meta.hpp"
 #include "../sid/composite.hpp"
+#include "./backend/common.hpp"
+#include "./extents.hpp"
 #include "./stencil_stage.hpp"
 
 namespace gridtools::fn {
     namespace run_impl_ {
+        // placeholder for a block temporary in the arguments of an executor, replaced by the actual SID on execution
+        template <class T>
+        struct block_tmp_arg {
+            using type = T;
+        };
+
+        template <class T>
+        struct is_block_tmp_arg : std::false_type {};
+
+        template <class T>
+        struct is_block_tmp_arg<block_tmp_arg<T>> : std::true_type {};
+
+        template <class Sids>
+        struct is_block_tmp_at {
+            template <class I>
+            using apply = is_block_tmp_arg<std::decay_t<tuple_util::element<I::value, Sids>>>;
+        };
+
+        template <class Sids>
+        using block_tmp_positions = meta::filter<is_block_tmp_at<Sids>::template apply,
+            meta::iseq_to_list<std::make_integer_sequence<int, tuple_util::size<Sids>::value>,
+                meta::list,
+                integral_constant>>;
+
+        template <class Alloc, class Sizes, class = void>
+        struct has_block_tmps : std::false_type {};
+
+        template <class Alloc, class Sizes>
+        struct has_block_tmps<Alloc,
+            Sizes,
+            std::void_t<decltype(allocate_block_tmp(
+                std::declval<Alloc &>(), std::declval<Sizes const &>(), extents<>(), backend::data_type<int>()))>>
+            : std::true_type {};
+
+        // replaces the placeholders with block temporaries if `Blocks` is not void, with global ones otherwise
+        template <class Alloc, class Sizes, class Blocks>
+        struct make_tmp_f {
+            Alloc &m_alloc;
+            Sizes const &m_sizes;
+
+            template <size_t I, class Sid>
+            auto operator()(Sid &&sid) const {
+                using sid_t = std::decay_t<Sid>;
+                if constexpr (!is_block_tmp_arg<sid_t>::value)
+                    return sid_t(std::forward<Sid>(sid));
+                else if constexpr (std::is_void_v<Blocks>)
+                    return allocate_global_tmp(m_alloc, m_sizes, backend::data_type<typename sid_t::type>());
+                else
+                    return allocate_block_tmp(m_alloc,
+                        m_sizes,
+                        typename Blocks::template tmp_extents_t<integral_constant<int, I>>(),
+                        backend::data_type<typename sid_t::type>());
+            }
+        };
+
         template <class Sids>
         auto make_composite(Sids &&sids) {
             using keys_t = meta::iseq_to_list<std::make_integer_sequence<int, std::tuple_size_v<Sids>>,
@@ -33,6 +93,88 @@ namespace gridtools::fn {
                 meta::rename<std::tuple, StageSpecs>());
         }
 
+        template <class Backend, class Domain>
+        using backend_has_block_tmps = has_block_tmps<decltype(tmp_allocator(std::declval<Backend const &>())), Domain>;
+
+        /**
+         *  Replaces the block temporary placeholders among the arguments with block temporaries if the backend
+         *  supports them, with global ones otherwise. `alloc` should outlive the result.
+         */
+        template <class StageSpecs, class Backend, class Alloc, class Domain, class Sids>
+        auto make_tmps(Backend const &, Alloc &alloc, Domain const &domain, Sids &&sids) {
+            using tmps_t = block_tmp_positions<std::decay_t<Sids>>;
+            using blocks_t = meta::if_c<backend_has_block_tmps<Backend, Domain>::value,
+                block_stencil_stages<StageSpecs, tmps_t>,
+                void>;
+            return tuple_util::transform_index(
+                make_tmp_f<Alloc, Domain, blocks_t>{alloc, domain}, std::forward<Sids>(sids));
+        }
+
+        /**
+         *  Runs the stages on the composite of the arguments, where `Tmps` are the positions of the block
+         *  temporaries. If the backend processes the domain block by block, the stages are applied one after
+         *  another to each block and are not fused. Otherwise the consecutive stages of `pointwise` stencils are
+         *  fused into a single sweep (see `fuse_stencil_stages`).
+         */
+        template <class Backend, class StageSpecs, class Tmps, class MakeIterator, class Domain, class Composite>
+        void run_stencil_stages_on(Backend const &backend,
+            StageSpecs,
+            Tmps,
+            MakeIterator const &make_iterator,
+            Domain const &domain,
+            Composite &&composite) {
+            if constexpr (!meta::is_empty<Tmps>::value && backend_has_block_tmps<Backend, Domain>::value) {
+                using blocks_t = block_stencil_stages<StageSpecs, Tmps>;
+                apply_block_stencil_stages(
+                    backend, domain, typename blocks_t::stages_t(), Tmps(), make_iterator, composite);
+            } else {
+                tuple_util::for_each(
+                    [&](auto stage) {
+                        apply_stencil_stage(backend, domain, std::move(stage), make_iterator, composite);
+                    },
+                    meta::rename<std::tuple, fuse_stencil_stages<StageSpecs>>());
+            }
+        }
+
+        /**
+         *  Runs the stages with block temporaries among the arguments. If the backend supports them, the domain is
+         *  processed block by block, otherwise the block temporaries are replaced by global ones.
+         */
+        template <class Backend, class StageSpecs, class MakeIterator, class Domain, class Sids>
+        void run_stencil_stages_with_block_tmps(
+            Backend const &backend, StageSpecs, MakeIterator const &make_iterator, Domain const &domain, Sids &&sids) {
+            using tmps_t = block_tmp_positions<std::decay_t<Sids>>;
+            auto alloc = tmp_allocator(backend);
+            run_stencil_stages_on(backend,
+                StageSpecs(),
+                tmps_t(),
+                make_iterator,
+                domain,
+                make_composite(make_tmps<StageSpecs>(backend, alloc, domain, std::forward<Sids>(sids))));
+        }
+
+        template <class Backend,
+            class StageSpecs,
+            class MakeIterator,
+            class Domain,
+            class Vertical,
+            class Composite,
+            class Seeds>
+        void run_column_stages_on(Backend const &backend,
+            StageSpecs,
+            MakeIterator const &make_iterator,
+            Domain const &domain,
+            Vertical,
+            Composite &&composite,
+            Seeds const &seeds) {
+            tuple_util::for_each(
+                [&](auto stage, auto const &seed) {
+                    apply_column_stage(backend, domain, std::move(stage), make_iterator, composite, Vertical(), seed);
+                },
+                meta::rename<std::tuple, StageSpecs>(),
+                seeds);
+        }
+
         template <class Backend,
             class StageSpecs,
             class MakeIterator,
@@ -58,6 +200,13 @@ namespace gridtools::fn {
         }
     } // namespace run_impl_
 
+    using run_impl_::block_tmp_arg;
+    using run_impl_::block_tmp_positions;
+    using run_impl_::make_composite;
+    using run_impl_::make_tmps;
     using run_impl_::run_column_stages;
+    using run_impl_::run_column_stages_on;
     using run_impl_::run_stencil_stages;
+    using run_impl_::run_stencil_stages_on;
+    using run_impl_::run_stencil_stages_with_block_tmps;
 } // namespace gridtools::fn
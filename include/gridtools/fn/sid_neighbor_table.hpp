@@ -52,6 +52,24 @@ namespace gridtools::fn::sid_neighbor_table {
             return neighbors;
         }
 
+        // reads only the requested neighbor instead of copying the whole list
+        template <class IndexDimension,
+            class NeighborDimension,
+            std::size_t MaxNumNeighbors,
+            class PtrHolder,
+            class Strides,
+            int I>
+        GT_FUNCTION auto neighbor_table_neighbor(
+            sid_neighbor_table<IndexDimension, NeighborDimension, MaxNumNeighbors, PtrHolder, Strides> const &table,
+            int index,
+            integral_constant<int, I>) {
+            static_assert(I >= 0 && std::size_t(I) < MaxNumNeighbors);
+            auto ptr = table.origin();
+            sid::shift(ptr, sid::get_stride<IndexDimension>(table.strides), index);
+            sid::shift(ptr, sid::get_stride<NeighborDimension>(table.strides), integral_constant<int, I>());
+            return *ptr;
+        }
+
         template <class IndexDimension, class NeighborDimension, std::size_t MaxNumNeighbors, class Sid>
         auto as_neighbor_table(Sid &&sid) {
 
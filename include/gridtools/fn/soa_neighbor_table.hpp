@@ -0,0 +1,94 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../common/array.hpp"
+#include "../common/defs.hpp"
+#include "../common/host_device.hpp"
+#include "../common/integral_constant.hpp"
+#include "../common/tuple_util.hpp"
+#include "./neighbor_table.hpp"
+
+/**
+ *   Neighbor-major (structure of arrays) neighbor table: the `n`-th neighbor of the location `i` is stored at
+ *   `data[n * stride + i]`.
+ *
+ *   A shift by a single offset reads one contiguous array, and consecutive locations read consecutive memory, which
+ *   makes the gathers vectorizable on CPUs and coalesced on GPUs.
+ *
+ *   The index type `T` could be narrower than `int` (f.e. `std::int16_t` for the local indices of a partitioned mesh)
+ *   to reduce the memory traffic; the indices are converted to `int` on access.
+ */
+namespace gridtools::fn::soa_neighbor_table {
+    namespace soa_neighbor_table_impl_ {
+        template <class T, std::size_t MaxNumNeighbors>
+        struct soa_neighbor_table {
+            T const *data;
+            int stride;
+        };
+
+        template <class T, std::size_t MaxNumNeighbors>
+        GT_FUNCTION array<int, MaxNumNeighbors> neighbor_table_neighbors(
+            soa_neighbor_table<T, MaxNumNeighbors> const &table, int index) {
+            array<int, MaxNumNeighbors> res;
+            for (std::size_t n = 0; n != MaxNumNeighbors; ++n)
+                res[n] = table.data[n * table.stride + index];
+            return res;
+        }
+
+        template <class T, std::size_t MaxNumNeighbors, int I>
+        GT_FUNCTION int neighbor_table_neighbor(
+            soa_neighbor_table<T, MaxNumNeighbors> const &table, int index, integral_constant<int, I>) {
+            static_assert(I >= 0 && std::size_t(I) < MaxNumNeighbors);
+            return table.data[I * table.stride + index];
+        }
+
+        template <std::size_t MaxNumNeighbors, class T>
+        soa_neighbor_table<T, MaxNumNeighbors> as_neighbor_table(T const *data, int stride) {
+            static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "SoA neighbor table needs signed indices");
+            return {data, stride};
+        }
+
+        /**
+         *  Converts the first `n` entries of any neighbor table accessible on the host into the neighbor-major layout
+         *  with the given stride (at least `n`). Throws if some index doesn't fit into `T`.
+         */
+        template <class T = int, class Table>
+        std::vector<T> make_data(Table const &table, int n, int stride = 0) {
+            using list_t = neighbor_table::neighbor_table_impl_::neighbor_list_type<Table>;
+            constexpr std::size_t size = tuple_util::size<list_t>::value;
+            if (stride < n)
+                stride = n;
+            std::vector<T> res(size * stride, T(-1));
+            for (int i = 0; i != n; ++i) {
+                std::size_t k = 0;
+                tuple_util::for_each(
+                    [&](auto neighbor) {
+                        if (neighbor < std::numeric_limits<T>::min() || neighbor > std::numeric_limits<T>::max())
+                            throw std::out_of_range("soa_neighbor_table: the index " + std::to_string(neighbor) +
+                                                    " doesn't fit into the index type");
+                        res[k++ * stride + i] = T(neighbor);
+                    },
+                    neighbor_table::neighbors(table, i));
+            }
+            return res;
+        }
+    } // namespace soa_neighbor_table_impl_
+
+    using soa_neighbor_table_impl_::as_neighbor_table;
+    using soa_neighbor_table_impl_::make_data;
+} // namespace gridtools::fn::soa_neighbor_table
@@ -9,14 +9,48 @@
  */
 #pragma once
 
+#include <type_traits>
+
 #include "../common/hymap.hpp"
 #include "../common/integral_constant.hpp"
 #include "../common/tuple_util.hpp"
+#include "../meta.hpp"
+#include "./extents.hpp"
 
 namespace gridtools::fn {
 
+    /**
+     *  Base for the stencils that dereference all their arguments only at zero offset (no shifts).
+     *  The executor fuses the consecutive stages of such stencils into a single sweep over the domain.
+     */
+    struct pointwise {};
+
+    /**
+     *  Stencils may declare the extents of their shifted accesses as `using extents_t = fn::extents<...>;`.
+     *  Those are needed for the stencils reading or writing block temporaries; `pointwise` stencils have
+     *  zero extents.
+     */
+    struct unknown_extents {};
+
+    namespace stencil_stage_impl_ {
+        template <class Stencil, class = void>
+        struct stencil_extents {
+            using type = meta::if_c<std::is_base_of_v<pointwise, Stencil>, extents<>, unknown_extents>;
+        };
+
+        template <class Stencil>
+        struct stencil_extents<Stencil, std::void_t<typename Stencil::extents_t>> {
+            using type = typename Stencil::extents_t;
+        };
+    } // namespace stencil_stage_impl_
+
     template <class Stencil, int Out, int... Ins>
     struct stencil_stage {
+        static constexpr int out = Out;
+        static constexpr bool is_pointwise = std::is_base_of_v<pointwise, Stencil>;
+        using ins_t = meta::list<integral_constant<int, Ins>...>;
+        using extents_t = typename stencil_stage_impl_::stencil_extents<Stencil>::type;
+
         template <class MakeIterator, class Ptr, class Strides>
         GT_FUNCTION void operator()(MakeIterator &&make_iterator, Ptr &ptr, Strides const &strides) const {
             *host_device::at_key<integral_constant<int, Out>>(ptr) =
@@ -32,4 +66,126 @@ namespace gridtools::fn {
         }
     };
 
+    /**
+     *  Stage of the block execution: computes `ComputeExtents` around each point of the block.
+     */
+    template <class Stage, class ComputeExtents>
+    struct blocked_stencil_stage : Stage {
+        using compute_extents_t = ComputeExtents;
+    };
+
+    namespace stencil_stage_impl_ {
+        // Stage `B` can be executed point by point right after `A` in the same loop if both only access the
+        // current point. This holds even if their arguments alias each other.
+        template <class A, class B>
+        using are_fusable = std::bool_constant<A::is_pointwise && B::is_pointwise>;
+
+        // The groups are accumulated in reverse order to have the current one at the front.
+        template <class Groups, class Stage>
+        struct fuse_step {
+            using type = meta::list<merged_stencil_stage<Stage>>;
+        };
+
+        template <class... Stages, class... Groups, class Stage>
+        struct fuse_step<meta::list<merged_stencil_stage<Stages...>, Groups...>, Stage> {
+            using type = meta::if_c<(are_fusable<Stages, Stage>::value && ...),
+                meta::list<merged_stencil_stage<Stages..., Stage>, Groups...>,
+                meta::list<merged_stencil_stage<Stage>, merged_stencil_stage<Stages...>, Groups...>>;
+        };
+
+        template <class Groups, class Stage>
+        using fuse_step_t = typename fuse_step<Groups, Stage>::type;
+
+        // the enclosing extents of all reads of `Arg` recorded in the multimap `Reads`
+        template <class Reads, class Arg, class Entry = meta::mp_find<Reads, Arg>>
+        struct read_extents {
+            using type = meta::rename<enclosing_extents, meta::pop_front<Entry>>;
+        };
+
+        template <class Reads, class Arg>
+        struct read_extents<Reads, Arg, void> {
+            using type = extents<>;
+        };
+
+        template <class Tmps, class Written, class State, class Stage>
+        struct block_step;
+
+        // the stages are visited backwards, the state is the reads of the later stages and the processed stages
+        template <class Tmps, class Written, class Reads, class... Blocked, class Stage>
+        struct block_step<Tmps, Written, meta::list<Reads, meta::list<Blocked...>>, Stage> {
+            using out_t = integral_constant<int, Stage::out>;
+            static constexpr bool writes_tmp = meta::st_contains<Tmps, out_t>::value;
+            static constexpr bool is_known = !std::is_same_v<typename Stage::extents_t, unknown_extents>;
+            template <class Arg>
+            using is_produced = meta::st_contains<Written, Arg>;
+            static_assert(is_known || (!writes_tmp && !meta::any_of<is_produced, typename Stage::ins_t>::value),
+                "Stencils reading or writing block temporaries must declare their extents.");
+
+            // the outputs that are not temporaries are computed only within the block
+            using compute_t = meta::if_c<writes_tmp, typename read_extents<Reads, out_t>::type, extents<>>;
+            using access_t = add_extents<compute_t, meta::if_c<is_known, typename Stage::extents_t, extents<>>>;
+
+            template <class R, class Arg>
+            using add_read = meta::mp_insert<R, meta::list<Arg, access_t>>;
+
+            using type = meta::list<meta::foldl<add_read, Reads, typename Stage::ins_t>,
+                meta::list<blocked_stencil_stage<Stage, compute_t>, Blocked...>>;
+        };
+
+        template <class Tmps, class Written>
+        struct block_step_f {
+            template <class State, class Stage>
+            using apply = typename block_step<Tmps, Written, State, Stage>::type;
+        };
+    } // namespace stencil_stage_impl_
+
+    /**
+     *  Groups consecutive `stencil_stage`s into `merged_stencil_stage`s which are safe to execute in a single sweep.
+     *
+     *  Only the stages of `pointwise` stencils are fused: the others access their arguments at shifted positions,
+     *  which may be written by another stage through the same or an aliasing argument, so each of them gets a
+     *  group of its own.
+     */
+    template <class Stages>
+    using fuse_stencil_stages =
+        meta::reverse<meta::foldl<stencil_stage_impl_::fuse_step_t, meta::list<>, meta::rename<meta::list, Stages>>>;
+
+    /**
+     *  Schedules the `stencil_stage`s to be executed block by block, with the arguments at the positions `Tmps`
+     *  being block temporaries.
+     *
+     *  Going backwards through the stages, a stage writing a temporary is computed at all points around the block
+     *  where the later stages read it (the halo is recomputed redundantly by the neighbouring blocks), the other
+     *  stages only within the block. This is correct as long as the outputs, which are not temporaries, are only
+     *  read at zero offset from the points where they are computed; this is checked at compile time.
+     *
+     *  - `stages_t` is the list of the `blocked_stencil_stage`s;
+     *  - `tmp_extents_t<Tmp>` are the extents where the temporary is accessed relative to the block.
+     */
+    template <class Stages, class Tmps>
+    struct block_stencil_stages {
+      private:
+        using stages_list_t = meta::rename<meta::list, Stages>;
+        template <class Stage>
+        using out_t = integral_constant<int, Stage::out>;
+        using written_t = meta::dedup<meta::transform<out_t, stages_list_t>>;
+        using state_t = meta::foldr<stencil_stage_impl_::block_step_f<Tmps, written_t>::template apply,
+            meta::list<meta::list<>, meta::list<>>,
+            stages_list_t>;
+        using reads_t = meta::first<state_t>;
+
+        template <class Arg>
+        using is_read_pointwise = std::bool_constant<meta::st_contains<Tmps, Arg>::value ||
+                                                     stencil_stage_impl_::read_extents<reads_t, Arg>::type::is_zero>;
+        static_assert(meta::all_of<is_read_pointwise, written_t>::value,
+            "Outputs of the stages with block temporaries, which are not temporaries themselves, may be read only at "
+            "zero offset.");
+
+      public:
+        using stages_t = meta::second<state_t>;
+
+        template <class Tmp>
+        using tmp_extents_t = typename stencil_stage_impl_::read_extents<reads_t, Tmp>::type;
+    };
+
 } // namespace gridtools::fn
@@ -0,0 +1,307 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../common/hymap.hpp"
+#include "../common/integral_constant.hpp"
+#include "../common/stride_util.hpp"
+#include "../common/tuple_util.hpp"
+#include "../meta.hpp"
+#include "../sid/composite.hpp"
+#include "../sid/concept.hpp"
+#include "../sid/multi_shift.hpp"
+#include "../thread_pool/concept.hpp"
+#include "./backend/naive.hpp"
+
+namespace gridtools::fn {
+    namespace tridiagonal_impl_ {
+        enum class tridiagonal_algorithm { automatic, thomas, partitioned };
+
+        // the partitioned algorithm doesn't split the columns into shorter segments than that
+        constexpr int min_segment_size = 16;
+
+        using a_t = integral_constant<int, 0>;
+        using b_t = integral_constant<int, 1>;
+        using c_t = integral_constant<int, 2>;
+        using d_t = integral_constant<int, 3>;
+        using x_t = integral_constant<int, 4>;
+
+        // access to the level `k` of the given argument of the column at `ptr`
+        template <class Key, class Ptr, class VStride>
+        decltype(auto) at(Ptr const &ptr, VStride const &v_stride, int k) {
+            return *sid::shifted(host_device::at_key<Key>(ptr), host_device::at_key<Key>(v_stride), k);
+        }
+
+        template <class T, class Ptr, class VStride>
+        void thomas(Ptr const &ptr, VStride const &v_stride, int n, T *cp) {
+            auto a = [&](int k) { return T(at<a_t>(ptr, v_stride, k)); };
+            auto b = [&](int k) { return T(at<b_t>(ptr, v_stride, k)); };
+            auto c = [&](int k) { return T(at<c_t>(ptr, v_stride, k)); };
+            auto d = [&](int k) { return T(at<d_t>(ptr, v_stride, k)); };
+            auto x = [&](int k) -> decltype(auto) { return at<x_t>(ptr, v_stride, k); };
+            T den = T(1) / b(0);
+            x(0) = d(0) * den;
+            // `c` at the last level is not needed
+            for (int k = 1; k < n; ++k) {
+                cp[k - 1] = c(k - 1) * den;
+                den = T(1) / (b(k) - a(k) * cp[k - 1]);
+                x(k) = (d(k) - a(k) * x(k - 1)) * den;
+            }
+            for (int k = n - 2; k >= 0; --k)
+                x(k) -= cp[k] * x(k + 1);
+        }
+
+        // the segments [first, last] of the partitioned algorithm, all of them have at least three levels
+        struct segment {
+            int first;
+            int last;
+        };
+
+        inline segment get_segment(int n, int segments, int s) {
+            return {int(long(s) * n / segments), int(long(s + 1) * n / segments) - 1};
+        }
+
+        /**
+         *  First phase of the partitioned algorithm for one segment.
+         *
+         *  The inner levels of the segment are solved for the three right hand sides: `d` (stored to `x`), `-a` at the
+         *  first inner level (`u`) and `-c` at the last inner level (`v`). Hence an inner `x` is expressed via the
+         *  first and the last level of the segment: `x[k] = y[k] + u[k] * x[first] + v[k] * x[last]`.
+         */
+        template <class T, class Ptr, class VStride>
+        void eliminate_segment(Ptr const &ptr, VStride const &v_stride, segment seg, T *cp, T *u, T *v) {
+            auto a = [&](int k) { return T(at<a_t>(ptr, v_stride, k)); };
+            auto b = [&](int k) { return T(at<b_t>(ptr, v_stride, k)); };
+            auto c = [&](int k) { return T(at<c_t>(ptr, v_stride, k)); };
+            auto d = [&](int k) { return T(at<d_t>(ptr, v_stride, k)); };
+            auto y = [&](int k) -> decltype(auto) { return at<x_t>(ptr, v_stride, k); };
+            int first = seg.first + 1;
+            int last = seg.last - 1;
+            assert(first <= last);
+            T den = T(1) / b(first);
+            cp[first] = c(first) * den;
+            y(first) = d(first) * den;
+            u[first] = -a(first) * den;
+            v[first] = 0;
+            for (int k = first + 1; k <= last; ++k) {
+                den = T(1) / (b(k) - a(k) * cp[k - 1]);
+                cp[k] = c(k) * den;
+                y(k) = (d(k) - a(k) * y(k - 1)) * den;
+                u[k] = -a(k) * u[k - 1] * den;
+                v[k] = -a(k) * v[k - 1] * den;
+            }
+            // the coupling to x[last] goes to `v` instead of the matrix
+            v[last] -= cp[last];
+            for (int k = last - 1; k >= first; --k) {
+                y(k) -= cp[k] * y(k + 1);
+                u[k] -= cp[k] * u[k + 1];
+                v[k] -= cp[k] * v[k + 1];
+            }
+        }
+
+        /**
+         *  Second phase: the first and the last levels of all segments form a tridiagonal system of the size
+         *  `2 * segments`, which is assembled and solved serially.
+         */
+        template <class T, class Ptr, class VStride>
+        void solve_reduced(
+            Ptr const &ptr, VStride const &v_stride, int n, int segments, T const *u, T const *v, T *buf) {
+            int m = 2 * segments;
+            T *ra = buf;
+            T *rb = ra + m;
+            T *rc = rb + m;
+            T *rd = rc + m;
+            auto a = [&](int k) { return T(at<a_t>(ptr, v_stride, k)); };
+            auto b = [&](int k) { return T(at<b_t>(ptr, v_stride, k)); };
+            auto c = [&](int k) { return T(at<c_t>(ptr, v_stride, k)); };
+            auto d = [&](int k) { return T(at<d_t>(ptr, v_stride, k)); };
+            auto x = [&](int k) -> decltype(auto) { return at<x_t>(ptr, v_stride, k); };
+            for (int s = 0; s < segments; ++s) {
+                auto [first, last] = get_segment(n, segments, s);
+                T y_next = x(first + 1);
+                ra[2 * s] = s == 0 ? T(0) : a(first);
+                rb[2 * s] = b(first) + c(first) * u[first + 1];
+                rc[2 * s] = c(first) * v[first + 1];
+                rd[2 * s] = d(first) - c(first) * y_next;
+                T y_prev = x(last - 1);
+                ra[2 * s + 1] = a(last) * u[last - 1];
+                rb[2 * s + 1] = b(last) + a(last) * v[last - 1];
+                rc[2 * s + 1] = s == segments - 1 ? T(0) : c(last);
+                rd[2 * s + 1] = d(last) - a(last) * y_prev;
+            }
+            rc[0] /= rb[0];
+            rd[0] /= rb[0];
+            for (int i = 1; i < m; ++i) {
+                T den = T(1) / (rb[i] - ra[i] * rc[i - 1]);
+                rc[i] *= den;
+                rd[i] = (rd[i] - ra[i] * rd[i - 1]) * den;
+            }
+            for (int i = m - 2; i >= 0; --i)
+                rd[i] -= rc[i] * rd[i + 1];
+            for (int s = 0; s < segments; ++s) {
+                auto [first, last] = get_segment(n, segments, s);
+                x(first) = rd[2 * s];
+                x(last) = rd[2 * s + 1];
+            }
+        }
+
+        // third phase: the inner levels are recovered from the first and the last level of the segment
+        template <class T, class Ptr, class VStride>
+        void substitute_segment(Ptr const &ptr, VStride const &v_stride, segment seg, T const *u, T const *v) {
+            auto x = [&](int k) -> decltype(auto) { return at<x_t>(ptr, v_stride, k); };
+            T x_first = x(seg.first);
+            T x_last = x(seg.last);
+            for (int k = seg.first + 1; k < seg.last; ++k)
+                x(k) += u[k] * x_first + v[k] * x_last;
+        }
+
+        inline int choose_segments(tridiagonal_algorithm algorithm, int segments, int n, long columns, int threads) {
+            int max_segments = n / min_segment_size;
+            switch (algorithm) {
+            case tridiagonal_algorithm::thomas:
+                return 1;
+            case tridiagonal_algorithm::partitioned:
+                return segments > 0 ? std::min(segments, n / 3) : std::max(1, max_segments);
+            default:
+                if (columns >= threads)
+                    return 1;
+                return std::clamp(int((threads + columns - 1) / columns), 1, std::max(1, max_segments));
+            }
+        }
+
+        /**
+         *  Solves the tridiagonal systems `a[k] * x[k - 1] + b[k] * x[k] + c[k] * x[k + 1] = d[k]` along the `Vertical`
+         *  dimension for all columns of the domain given by `sizes`. `a`, `b`, `c`, `d` and `x` are SIDs, `x` is
+         *  written; `a` at the first level and `c` at the last level are not accessed.
+         *
+         *  Two algorithms are available:
+         *  - `thomas`: the Thomas algorithm, the columns are solved in parallel.
+         *  - `partitioned`: the columns are additionally split into segments which are eliminated in parallel
+         *    (partition method). The first and the last level of each segment form a reduced tridiagonal system
+         *    of twice the number of segments, which is solved serially per column. This does about twice the work of
+         *    the Thomas algorithm, but exposes parallelism along the columns.
+         *  `automatic` picks the partitioned algorithm if there are fewer columns than threads and the columns are
+         *  long enough; the number of segments is chosen to occupy all threads. `segments` overrides the number of
+         *  segments for the partitioned algorithm.
+         *
+         *  As the Thomas algorithm, both are stable for diagonally dominant systems. The SIDs are not restricted to
+         *  fn, e.g. `stencil` data stores could be passed as well.
+         */
+        template <class Vertical,
+            class ThreadPool,
+            int ColumnLanes,
+            class Sizes,
+            class A,
+            class B,
+            class C,
+            class D,
+            class X>
+        void tridiagonal_solve(backend::naive_with_threadpool<ThreadPool, ColumnLanes>,
+            Sizes const &sizes,
+            A &&a,
+            B &&b,
+            C &&c,
+            D &&d,
+            X &&x,
+            tridiagonal_algorithm algorithm = tridiagonal_algorithm::automatic,
+            int segments = 0) {
+            using T = std::remove_const_t<sid::element_type<std::decay_t<X>>>;
+            auto composite = sid::composite::keys<a_t, b_t, c_t, d_t, x_t>::make_values(std::forward<A>(a),
+                std::forward<B>(b),
+                std::forward<C>(c),
+                std::forward<D>(d),
+                std::forward<X>(x));
+            auto origin = sid::get_origin(composite)();
+            auto strides = sid::get_strides(composite);
+            auto const &v_stride = sid::get_stride<Vertical>(strides);
+            int n = at_key<Vertical>(sizes);
+            if (n <= 0)
+                return;
+            auto h_sizes = hymap::canonicalize_and_remove_key<Vertical>(sizes);
+            using dims_t = meta::rename<hymap::keys, get_keys<decltype(h_sizes)>>;
+            auto loop_sizes = tuple_util::transform([](auto size) { return int(size); }, h_sizes);
+            long columns =
+                stride_util::total_size(tuple_util::transform([](int size) { return long(size); }, loop_sizes));
+            if (columns <= 0)
+                return;
+            int threads = thread_pool::get_max_threads(ThreadPool());
+            segments = choose_segments(algorithm, segments, n, columns, threads);
+
+            // the linear index of the column
+            auto column_index = [column_strides = stride_util::make_strides_from_sizes(loop_sizes)](auto... indices) {
+                return tuple_util::fold([](long acc, long i) { return acc + i; },
+                    0l,
+                    tuple_util::transform([](long index, long stride) { return index * stride; },
+                        tuple(indices...),
+                        column_strides));
+            };
+            auto column_ptr = [&](auto... indices) {
+                auto ptr = origin;
+                sid::multi_shift(ptr, strides, dims_t::make_values(indices...));
+                return ptr;
+            };
+            auto for_each_column = [&](auto const &f) {
+                tuple_util::apply(
+                    [&](auto... sizes) { thread_pool::parallel_for_loop(ThreadPool(), f, sizes...); }, loop_sizes);
+            };
+
+            if (segments < 2) {
+                std::unique_ptr<T[]> buf(new T[long(threads) * n]);
+                for_each_column([&](auto... indices) {
+                    thomas(column_ptr(indices...),
+                        v_stride,
+                        n,
+                        buf.get() + long(thread_pool::get_thread_num(ThreadPool())) * n);
+                });
+                return;
+            }
+
+            // `cp`, `u` and `v` of all columns followed by the reduced systems
+            std::unique_ptr<T[]> buf(new T[columns * (3l * n + 8l * segments)]);
+            auto column_buf = [&](long i) { return buf.get() + i * 3l * n; };
+            T *reduced_buf = buf.get() + columns * 3l * n;
+            auto for_each_segment = [&](auto const &f) {
+                tuple_util::apply(
+                    [&](auto... sizes) { thread_pool::parallel_for_loop(ThreadPool(), f, segments, sizes...); },
+                    loop_sizes);
+            };
+            for_each_segment([&](int s, auto... indices) {
+                T *cbuf = column_buf(column_index(indices...));
+                eliminate_segment(
+                    column_ptr(indices...), v_stride, get_segment(n, segments, s), cbuf, cbuf + n, cbuf + 2 * n);
+            });
+            for_each_column([&](auto... indices) {
+                long i = column_index(indices...);
+                T *cbuf = column_buf(i);
+                solve_reduced(column_ptr(indices...),
+                    v_stride,
+                    n,
+                    segments,
+                    cbuf + n,
+                    cbuf + 2 * n,
+                    reduced_buf + i * 8l * segments);
+            });
+            for_each_segment([&](int s, auto... indices) {
+                T *cbuf = column_buf(column_index(indices...));
+                substitute_segment(
+                    column_ptr(indices...), v_stride, get_segment(n, segments, s), cbuf + n, cbuf + 2 * n);
+            });
+        }
+    } // namespace tridiagonal_impl_
+
+    using tridiagonal_impl_::tridiagonal_algorithm;
+    using tridiagonal_impl_::tridiagonal_solve;
+} // namespace gridtools::fn
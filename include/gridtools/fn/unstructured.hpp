@@ -9,11 +9,19 @@
  */
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 #include "../common/defs.hpp"
 #include "../common/hymap.hpp"
+#include "../common/tuple.hpp"
+#include "../common/tuple_util.hpp"
 #include "../meta/logical.hpp"
+#include "../meta/make_indices.hpp"
+#include "../meta/rename.hpp"
 #include "../sid/concept.hpp"
 #include "../stencil/positional.hpp"
 #include "./common_interface.hpp"
@@ -86,7 +94,7 @@ namespace gridtools::fn {
         template <class Tag, class Ptr, class Strides, class Domain, class Conn, class Offset>
         GT_FUNCTION constexpr auto horizontal_shift(iterator<Tag, Ptr, Strides, Domain> const &it, Conn, Offset) {
             auto const &table = host_device::at_key<Conn>(it.m_domain.m_tables);
-            auto new_index = it.m_index == -1 ? -1 : get<Offset::value>(neighbor_table::neighbors(table, it.m_index));
+            auto new_index = it.m_index == -1 ? -1 : neighbor_table::neighbor<Offset::value>(table, it.m_index);
             auto shifted = it;
             shifted.m_index = new_index;
             return shifted;
@@ -118,6 +126,131 @@ namespace gridtools::fn {
         }
         GT_NVCC_DIAG_POP_SUPPRESS(940)
 
+        template <class Tag, class Ptr, class Strides, class Domain>
+        GT_FUNCTION constexpr auto deref_at(iterator<Tag, Ptr, Strides, Domain> const &it, int index) {
+            decltype(auto) stride = host_device::at_key<Tag>(sid::get_stride<dim::horizontal>(it.m_strides));
+            return *sid::shifted(it.m_ptr, stride, index);
+        }
+
+        struct no_weights {
+            template <size_t I, class Op, class Acc, class... Vals>
+            GT_FUNCTION constexpr decltype(auto) apply(Op const &op, Acc const &acc, Vals const &...vals) const {
+                return op(acc, vals...);
+            }
+        };
+
+        template <class Weights>
+        struct neighbor_weights_holder {
+            Weights m_weights;
+
+            template <size_t I, class Op, class Acc, class... Vals>
+            GT_FUNCTION constexpr decltype(auto) apply(Op const &op, Acc const &acc, Vals const &...vals) const {
+                return op(acc, tuple_util::host_device::get<I>(m_weights), vals...);
+            }
+        };
+
+        template <class Weights>
+        GT_FUNCTION constexpr neighbor_weights_holder<Weights> neighbor_weights(Weights const &weights) {
+            return {weights};
+        }
+
+        // the accumulator has the type of the result of `op`, not of `init`: `0` as `init` of a sum of doubles is fine
+        template <class Op, class Acc, class Weights, class It, class... Its>
+        using reduce_result_t = std::decay_t<decltype(std::declval<Weights const &>().template apply<0>(
+            std::declval<Op const &>(),
+            std::declval<Acc const &>(),
+            deref_at(std::declval<It const &>(), 0),
+            deref_at(std::declval<Its const &>(), 0)...))>;
+
+        template <class Conn,
+            class Op,
+            class Init,
+            class Weights,
+            class Tag,
+            class Ptr,
+            class Strides,
+            class Domain,
+            class... Its>
+        GT_FUNCTION constexpr auto reduce_neighbors_impl(Op const &op,
+            Init const &init,
+            Weights const &weights,
+            iterator<Tag, Ptr, Strides, Domain> const &it,
+            Its const &...its) {
+            using it_t = iterator<Tag, Ptr, Strides, Domain>;
+            using acc_t = reduce_result_t<Op, Init, Weights, it_t, Its...>;
+            static_assert(std::is_same_v<reduce_result_t<Op, acc_t, Weights, it_t, Its...>, acc_t>,
+                "the reduction operation should return the type of its accumulator");
+            acc_t acc = init;
+            assert(((its.m_index == it.m_index) && ...));
+            if (it.m_index == -1)
+                return acc;
+            auto const &table = host_device::at_key<Conn>(it.m_domain.m_tables);
+            // the neighbor list is fetched once for all neighbors and all iterators
+            decltype(auto) neighbors = neighbor_table::neighbors(table, it.m_index);
+            using neighbors_t = std::decay_t<decltype(neighbors)>;
+            constexpr bool branch_free = std::is_arithmetic_v<acc_t> &&
+                                         std::is_arithmetic_v<std::decay_t<decltype(deref_at(it, 0))>> &&
+                                         (std::is_arithmetic_v<std::decay_t<decltype(deref_at(its, 0))>> && ...);
+            // skipped neighbors read at the first valid neighbor instead, the index of the current location may be
+            // out of range on the neighbor location
+            int fallback = -1;
+            if constexpr (branch_free) {
+                tuple_util::host_device::for_each(
+                    [&](int neighbor) { fallback = fallback == -1 ? neighbor : fallback; }, neighbors);
+                if (fallback == -1)
+                    return acc;
+            }
+            tuple_util::host_device::for_each(
+                [&](auto i) {
+                    constexpr size_t n = decltype(i)::value;
+                    int neighbor = tuple_util::host_device::get<n>(neighbors);
+                    if constexpr (branch_free) {
+                        // the value read for a skipped neighbor is discarded by a select
+                        bool valid = neighbor != -1;
+                        int index = valid ? neighbor : fallback;
+                        acc_t next = weights.template apply<n>(op, acc, deref_at(it, index), deref_at(its, index)...);
+                        acc = valid ? next : acc;
+                    } else if (neighbor != -1) {
+                        acc = weights.template apply<n>(op, acc, deref_at(it, neighbor), deref_at(its, neighbor)...);
+                    }
+                },
+                meta::rename<tuple, meta::make_indices<tuple_util::size<neighbors_t>>>());
+            return acc;
+        }
+
+        /**
+         *  Reduces over the neighbors of the current location along the connectivity `Conn`.
+         *
+         *  `op(acc, vals...)` is called for every valid neighbor, where `vals` are the values of the iterators `its`
+         *  at that neighbor. The neighbors are visited in the order of the neighbor table; skipped neighbors (-1) do
+         *  not contribute. If the first argument after `init` is `neighbor_weights(weights)`, `op` additionally gets
+         *  the weight of the neighbor: `op(acc, get<I>(weights), vals...)`. The accumulator and the result have the
+         *  type returned by `op`, which is converted from `init`.
+         *  \code
+         *  auto sum = reduce_neighbors(v2e(), std::plus<>(), 0., in);
+         *  auto div = reduce_neighbors(v2e(), [](auto acc, auto sign, auto flux) { return acc + sign * flux; },
+         *      0., neighbor_weights(deref(signs)), flux);
+         *  \endcode
+         *
+         *  Unlike the manual loop with `shift`, the neighbor list is fetched only once. The loop is unrolled and, for
+         *  arithmetic values, the skip values are handled with selects instead of branches.
+         */
+        template <class Conn, class Op, class Init, class Weights, class It, class... Its>
+        GT_FUNCTION constexpr auto reduce_neighbors(Conn,
+            Op const &op,
+            Init const &init,
+            neighbor_weights_holder<Weights> const &weights,
+            It const &it,
+            Its const &...its) {
+            return reduce_neighbors_impl<Conn>(op, init, weights, it, its...);
+        }
+
+        template <class Conn, class Op, class Init, class It, class... Its>
+        GT_FUNCTION constexpr auto reduce_neighbors(
+            Conn, Op const &op, Init const &init, It const &it, Its const &...its) {
+            return reduce_neighbors_impl<Conn>(op, init, no_weights(), it, its...);
+        }
+
         template <class Domain>
         struct make_iterator {
             Domain m_domain;
@@ -175,6 +308,8 @@ namespace gridtools::fn {
     using unstructured_impl_::can_deref;
     using unstructured_impl_::connectivity;
     using unstructured_impl_::deref;
+    using unstructured_impl_::neighbor_weights;
+    using unstructured_impl_::reduce_neighbors;
     using unstructured_impl_::shift;
     using unstructured_impl_::unstructured_domain;
 } // namespace gridtools::fn
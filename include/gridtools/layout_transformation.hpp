@@ -43,22 +43,37 @@ namespace gridtools {
 
 #ifdef GT_CUDACC
         template <class T, class Dims, class DstStrides, class SrcSrides>
-        void transform_impl(T *dst, T const *src, Dims dims, DstStrides dst_strides, SrcSrides src_strides) {
+        void transform_impl(
+            T *dst, T const *src, Dims dims, DstStrides dst_strides, SrcSrides src_strides, bool nontemporal) {
             assert(is_gpu_ptr(dst) == is_gpu_ptr(src));
             if (is_gpu_ptr(dst))
                 impl::transform_gpu_loop(dst, src, std::move(dims), std::move(dst_strides), std::move(src_strides));
             else
-                impl::transform_cpu_loop(dst, src, std::move(dims), std::move(dst_strides), std::move(src_strides));
+                impl::transform_cpu_loop(
+                    dst, src, std::move(dims), std::move(dst_strides), std::move(src_strides), nontemporal);
         }
 #else
         template <class T, class Dims, class DstStrides, class SrcStrides>
-        void transform_impl(T *dst, T const *src, Dims dims, DstStrides dst_strides, SrcStrides src_strides) {
-            impl::transform_cpu_loop(dst, src, dims, dst_strides, src_strides);
+        void transform_impl(
+            T *dst, T const *src, Dims dims, DstStrides dst_strides, SrcStrides src_strides, bool nontemporal) {
+            impl::transform_cpu_loop(dst, src, dims, dst_strides, src_strides, nontemporal);
         }
 #endif
 
+        /**
+         *  Copies the `dims` sized array from `src` to `dst` with the given strides.
+         *
+         *  On the host the loop order follows the strides of both arrays and the copy is done in cache sized tiles.
+         *  `nontemporal` requests streaming stores to the destination (if supported by the compiler); that pays off
+         *  when the destination is not going to be read soon and doesn't fit into the cache.
+         */
         template <class T, class Dims, class DstStrides, class SrcStrides>
-        void transform_layout(T *dst, T const *src, Dims dims, DstStrides dst_strides, SrcStrides src_strides) {
+        void transform_layout(T *dst,
+            T const *src,
+            Dims dims,
+            DstStrides dst_strides,
+            SrcStrides src_strides,
+            bool nontemporal = false) {
             assert(dst);
             assert(src);
             static_assert(tuple_util::size<Dims>::value > 0, "wrong size of Dims");
@@ -66,7 +81,8 @@ namespace gridtools {
                 tuple_util::size<Dims>::value == tuple_util::size<DstStrides>::value, "wrong size of DstStrides");
             static_assert(
                 tuple_util::size<Dims>::value == tuple_util::size<SrcStrides>::value, "wrong size of SrcStrides");
-            transform_impl(dst, src, extend(dims, 1), extend(dst_strides, 0), extend(src_strides, 0));
+            transform_impl(
+                dst, src, extend(dims, 1), extend(dst_strides, 0), extend(src_strides, 0), nontemporal);
         }
     } // namespace layout_transformation_impl_
     using layout_transformation_impl_::transform_layout;
@@ -10,46 +10,147 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdlib>
 #include <utility>
 
-#include "../common/hypercube_iterator.hpp"
+#include "../common/array.hpp"
 #include "../common/tuple_util.hpp"
 
 namespace gridtools {
     namespace impl {
+        template <size_t N, class Tup>
+        array<std::ptrdiff_t, N> transform_cpu_to_array(Tup const &tup) {
+            array<std::ptrdiff_t, N> res;
+            size_t i = 0;
+            tuple_util::for_each([&](auto val) { res[i++] = val; }, tup);
+            return res;
+        }
+
+        // the dimension with the smallest stride among the dimensions of the size greater than one
+        template <size_t N>
+        size_t transform_cpu_unit_stride_dim(array<std::ptrdiff_t, N> const &sizes,
+            array<std::ptrdiff_t, N> const &strides) {
+            size_t res = 0;
+            for (size_t d = 1; d != N; ++d)
+                if (sizes[d] > 1 && (sizes[res] <= 1 || std::abs(strides[d]) < std::abs(strides[res])))
+                    res = d;
+            return res;
+        }
+
+        template <bool NonTemporal, class T>
+        void transform_cpu_row(
+            T *__restrict__ dst, T const *__restrict__ src, std::ptrdiff_t size, std::ptrdiff_t src_stride) {
+#if _OPENMP >= 201811
+            if constexpr (NonTemporal) {
+#pragma omp simd nontemporal(dst)
+                for (std::ptrdiff_t n = 0; n < size; ++n)
+                    dst[n] = src[n * src_stride];
+                return;
+            }
+#endif
+#pragma omp simd
+            for (std::ptrdiff_t n = 0; n < size; ++n)
+                dst[n] = src[n * src_stride];
+        }
+
+        template <bool NonTemporal, class T>
+        void transform_cpu_row(T *__restrict__ dst,
+            T const *__restrict__ src,
+            std::ptrdiff_t size,
+            std::ptrdiff_t dst_stride,
+            std::ptrdiff_t src_stride) {
+            if (dst_stride == 1)
+                return transform_cpu_row<NonTemporal>(dst, src, size, src_stride);
+            for (std::ptrdiff_t n = 0; n < size; ++n)
+                dst[n * dst_stride] = src[n * src_stride];
+        }
+
+        /**
+         *  The copy is done in two dimensional tiles spanned by the unit stride dimensions of the source and of the
+         *  destination. The tiles are small enough for both the source and the destination part to stay in L1, the
+         *  innermost loop goes along the destination unit stride. If the unit stride dimensions coincide, the tiles are
+         *  one dimensional. The tiles of all the remaining dimensions are distributed between the threads.
+         */
+        template <bool NonTemporal, class T, size_t N>
+        void transform_cpu_tiled(T *dst,
+            T const *__restrict__ src,
+            array<std::ptrdiff_t, N> const &sizes,
+            array<std::ptrdiff_t, N> const &dst_strides,
+            array<std::ptrdiff_t, N> const &src_strides) {
+            constexpr std::ptrdiff_t tile_size_2d = std::max<std::ptrdiff_t>(8, 256 / sizeof(T));
+            constexpr std::ptrdiff_t tile_size_1d = std::max<std::ptrdiff_t>(64, 16384 / sizeof(T));
+
+            for (auto size : sizes)
+                if (size <= 0)
+                    return;
+
+            size_t inner = transform_cpu_unit_stride_dim(sizes, dst_strides);
+            size_t outer = transform_cpu_unit_stride_dim(sizes, src_strides);
+            bool is_1d = inner == outer;
+
+            std::ptrdiff_t inner_tile = is_1d ? tile_size_1d : tile_size_2d;
+            std::ptrdiff_t outer_tile = is_1d ? 1 : tile_size_2d;
+            std::ptrdiff_t inner_tiles = (sizes[inner] + inner_tile - 1) / inner_tile;
+            std::ptrdiff_t outer_tiles = is_1d ? 1 : (sizes[outer] + outer_tile - 1) / outer_tile;
+
+            // the remaining dimensions are treated as one
+            array<size_t, N> rest;
+            size_t rest_dims = 0;
+            std::ptrdiff_t rest_size = 1;
+            for (size_t d = 0; d != N; ++d)
+                if (d != inner && (is_1d || d != outer)) {
+                    rest[rest_dims++] = d;
+                    rest_size *= sizes[d];
+                }
+
+            std::ptrdiff_t total = rest_size * outer_tiles * inner_tiles;
+#pragma omp parallel for
+            for (std::ptrdiff_t item = 0; item < total; ++item) {
+                std::ptrdiff_t inner_first = item % inner_tiles * inner_tile;
+                std::ptrdiff_t outer_first = item / inner_tiles % outer_tiles * outer_tile;
+                std::ptrdiff_t index = item / inner_tiles / outer_tiles;
+                std::ptrdiff_t dst_offset = inner_first * dst_strides[inner];
+                std::ptrdiff_t src_offset = inner_first * src_strides[inner];
+                for (size_t r = 0; r != rest_dims; ++r) {
+                    size_t d = rest[r];
+                    dst_offset += index % sizes[d] * dst_strides[d];
+                    src_offset += index % sizes[d] * src_strides[d];
+                    index /= sizes[d];
+                }
+                std::ptrdiff_t inner_size = std::min(inner_tile, sizes[inner] - inner_first);
+                if (is_1d) {
+                    transform_cpu_row<NonTemporal>(
+                        dst + dst_offset, src + src_offset, inner_size, dst_strides[inner], src_strides[inner]);
+                    continue;
+                }
+                std::ptrdiff_t outer_last = std::min(outer_first + outer_tile, sizes[outer]);
+                for (std::ptrdiff_t o = outer_first; o < outer_last; ++o)
+                    transform_cpu_row<NonTemporal>(dst + dst_offset + o * dst_strides[outer],
+                        src + src_offset + o * src_strides[outer],
+                        inner_size,
+                        dst_strides[inner],
+                        src_strides[inner]);
+            }
+        }
+
         template <class T, class Dims, class DstStrides, class SrcSrides>
-        void transform_cpu_loop(
-            T *dst, T const *__restrict__ src, Dims dims, DstStrides dst_strides, SrcSrides src_strides) {
-
-            auto omp_loop = [size_i = tuple_util::get<0>(dims),
-                                size_j = tuple_util::get<1>(dims),
-                                size_k = tuple_util::get<2>(dims),
-                                src_stride_i = tuple_util::get<0>(src_strides),
-                                src_stride_j = tuple_util::get<1>(src_strides),
-                                src_stride_k = tuple_util::get<2>(src_strides),
-                                dst_stride_i = tuple_util::get<0>(dst_strides),
-                                dst_stride_j = tuple_util::get<1>(dst_strides),
-                                dst_stride_k = tuple_util::get<2>(dst_strides)](T *dst, T const *__restrict__ src) {
-#pragma omp parallel for collapse(3)
-                for (int i = 0; i < size_i; ++i)
-                    for (int j = 0; j < size_j; ++j)
-                        for (int k = 0; k < size_k; ++k)
-                            dst[dst_stride_i * i + dst_stride_j * j + dst_stride_k * k] =
-                                src[src_stride_i * i + src_stride_j * j + src_stride_k * k];
-            };
-
-            auto offset = [](auto const &index, auto const &strides) {
-                size_t res = 0;
-                tuple_util::for_each([&res](auto i, auto stride) { res += i * stride; }, index, strides);
-                return res;
-            };
-
-            auto &&extra_src_strides = tuple_util::drop_front<3>(std::move(src_strides));
-            auto &&extra_dst_strides = tuple_util::drop_front<3>(std::move(dst_strides));
-
-            for (auto i : make_hypercube_view(tuple_util::drop_front<3>(dims)))
-                omp_loop(dst + offset(i, extra_dst_strides), src + offset(i, extra_src_strides));
+        void transform_cpu_loop(T *dst,
+            T const *__restrict__ src,
+            Dims dims,
+            DstStrides dst_strides,
+            SrcSrides src_strides,
+            bool nontemporal = false) {
+            constexpr size_t n = tuple_util::size<Dims>::value;
+            auto sizes = transform_cpu_to_array<n>(dims);
+            auto dst_strides_array = transform_cpu_to_array<n>(dst_strides);
+            auto src_strides_array = transform_cpu_to_array<n>(src_strides);
+            if (nontemporal)
+                transform_cpu_tiled<true>(dst, src, sizes, dst_strides_array, src_strides_array);
+            else
+                transform_cpu_tiled<false>(dst, src, sizes, dst_strides_array, src_strides_array);
         }
     } // namespace impl
 } // namespace gridtools
@@ -12,13 +12,120 @@
 #include <algorithm>
 #include <type_traits>
 
+#include "../common/array.hpp"
 #include "../common/defs.hpp"
+#include "../common/tuple.hpp"
+#include "../common/tuple_util.hpp"
 #include "functions.hpp"
 
 namespace gridtools {
     namespace reduction {
+        namespace cpu_impl_ {
+            // number of the independent partial results per thread; should be a multiple of the SIMD width
+            constexpr size_t lanes = 8;
+            // rows are split into the blocks of that size to parallelize also the reductions with a few long rows
+            constexpr size_t block_size = 4096;
+
+            template <class Fs, class Accs, class T>
+            void accumulate(Fs const &fs, Accs &accs, T const *buff, size_t n) {
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes)
+#pragma omp simd
+                    for (size_t l = 0; l < lanes; ++l)
+                        tuple_util::for_each(
+                            [x = buff[i + l], l](auto f, auto &acc) { acc[l] = f(acc[l], x); }, fs, accs);
+                for (; i != n; ++i)
+                    tuple_util::for_each([x = buff[i]](auto f, auto &acc) { acc[0] = f(acc[0], x); }, fs, accs);
+            }
+
+            template <class T>
+            struct candidate {
+                T value;
+                size_t offset;
+            };
+
+            // keeps the preferred candidate; the ties are resolved in favour of the smaller offset
+            template <class F, class T>
+            void merge(F const &f, candidate<T> &dst, candidate<T> const &src) {
+                if (src.offset == not_found)
+                    return;
+                if (dst.offset == not_found || f(src.value, dst.value) ||
+                    (!f(dst.value, src.value) && src.offset < dst.offset))
+                    dst = src;
+            }
+
+            template <class F, class T>
+            candidate<T> locate(F const &f, T const *buff, size_t offset, size_t n) {
+                T values[lanes];
+                size_t offsets[lanes];
+                for (size_t l = 0; l != lanes; ++l) {
+                    values[l] = buff[offset];
+                    offsets[l] = offset;
+                }
+                size_t i = 0;
+                for (; i + lanes <= n; i += lanes)
+#pragma omp simd
+                    for (size_t l = 0; l < lanes; ++l) {
+                        T x = buff[offset + i + l];
+                        bool better = f(x, values[l]);
+                        values[l] = better ? x : values[l];
+                        offsets[l] = better ? offset + i + l : offsets[l];
+                    }
+                candidate<T> res = {values[0], offsets[0]};
+                for (size_t l = 1; l != lanes; ++l)
+                    merge(f, res, {values[l], offsets[l]});
+                for (; i != n; ++i)
+                    merge(f, res, {buff[offset + i], offset + i});
+                return res;
+            }
+
+            template <class T>
+            array<T, lanes> broadcast(T const &val) {
+                array<T, lanes> res;
+                for (auto &dst : res)
+                    dst = val;
+                return res;
+            }
+        } // namespace cpu_impl_
+
         struct cpu {};
 
+        /**
+         *  Computes several reductions at once in a single pass over the buffer.
+         *
+         *  The buffer consists of `rows` rows of `row_size` elements that start `row_stride` elements apart; the
+         *  elements between the rows are skipped. `res` holds the initial values that also should be the identities
+         *  of the corresponding `fs`.
+         */
+        template <class... Ts, class... Fs, class T>
+        tuple<Ts...> reduction_reduce_fused(
+            cpu, tuple<Ts...> res, tuple<Fs...> fs, T const *buff, size_t rows, size_t row_size, size_t row_stride) {
+            using namespace cpu_impl_;
+            size_t row_blocks = (row_size + block_size - 1) / block_size;
+            // the threads are seeded from a copy, because `res` is updated by those that have already finished
+            auto const inits = res;
+#pragma omp parallel
+            {
+                auto accs = tuple_util::transform([](auto const &init) { return broadcast(init); }, inits);
+#pragma omp for collapse(2) nowait
+                for (size_t r = 0; r < rows; ++r)
+                    for (size_t b = 0; b < row_blocks; ++b) {
+                        size_t first = b * block_size;
+                        accumulate(fs, accs, buff + r * row_stride + first, std::min(block_size, row_size - first));
+                    }
+#pragma omp critical
+                tuple_util::for_each(
+                    [](auto f, auto &dst, auto const &acc) {
+                        for (auto const &src : acc)
+                            dst = f(dst, src);
+                    },
+                    fs,
+                    res,
+                    accs);
+            }
+            return res;
+        }
+
         template <class T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
         T reduction_reduce(cpu, T res, plus, T const *buff, size_t n) {
 #pragma omp parallel for reduction(+ : res)
@@ -59,28 +166,52 @@ namespace gridtools {
             return res;
         }
 
+        /**
+         *  Returns the offset of the preferred element (see `argmin` in functions.hpp) in the buffer or `not_found`
+         *  if it is empty. The buffer layout is the same as for `reduction_reduce_fused`.
+         */
         template <class F, class T>
-        T reduction_reduce(cpu, T res, F, T const *buff, size_t n) {
-            static_assert(std::is_empty<F>(), "OpenMP reduction supports only stateless functors.");
-            static_assert(
-                std::is_default_constructible<F>(), "OpenMP reduction supports only default constructible functors.");
-#pragma omp declare reduction(gridtools_generic:T : omp_out = F()(omp_out, omp_in)) initializer(omp_priv = omp_orig)
-#pragma omp parallel for reduction(gridtools_generic : res)
-            for (size_t i = 0; i < n; i++)
-                res = F()(res, buff[i]);
-            return res;
+        size_t reduction_locate(cpu, F f, T const *buff, size_t rows, size_t row_size, size_t row_stride) {
+            using namespace cpu_impl_;
+            size_t row_blocks = (row_size + block_size - 1) / block_size;
+            candidate<T> res = {T(), not_found};
+#pragma omp parallel
+            {
+                candidate<T> acc = {T(), not_found};
+#pragma omp for collapse(2) nowait
+                for (size_t r = 0; r < rows; ++r)
+                    for (size_t b = 0; b < row_blocks; ++b) {
+                        size_t first = b * block_size;
+                        merge(f, acc, locate(f, buff, r * row_stride + first, std::min(block_size, row_size - first)));
+                    }
+#pragma omp critical
+                merge(f, res, acc);
+            }
+            return res.offset;
+        }
+
+        // generic functors and types are reduced via per thread partial results instead of `omp declare reduction`
+        template <class F, class T>
+        T reduction_reduce(cpu, T res, F f, T const *buff, size_t n) {
+            return tuple_util::get<0>(reduction_reduce_fused(cpu(), tuple<T>(res), tuple<F>(f), buff, 1, n, n));
         }
 
         inline size_t reduction_round_size(cpu, size_t size) { return size; }
         inline size_t reduction_allocation_size(cpu, size_t size) { return size; }
 
+        /**
+         *  Fills the padding between the rows and after the data (up to `rounded_size`) with `val`, the data itself
+         *  is not touched.
+         */
         template <class T>
-        void reduction_fill(cpu, T const &val, T *ptr, size_t data_size, size_t rounded_size, bool has_holes) {
-            if (!has_holes) {
-                ptr += data_size;
-                rounded_size -= data_size;
+        void reduction_fill(
+            cpu, T const &val, T *ptr, size_t rows, size_t row_size, size_t row_stride, size_t rounded_size) {
+            if (rows > 1 && row_size != row_stride) {
+#pragma omp parallel for
+                for (size_t r = 0; r < rows - 1; ++r)
+                    std::fill(ptr + r * row_stride + row_size, ptr + (r + 1) * row_stride, val);
             }
-            std::fill(ptr, ptr + rounded_size, val);
+            std::fill(ptr + (rows ? (rows - 1) * row_stride + row_size : 0), ptr + rounded_size, val);
         }
     } // namespace reduction
 } // namespace gridtools
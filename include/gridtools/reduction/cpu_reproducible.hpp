@@ -0,0 +1,125 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <type_traits>
+
+#include "../common/defs.hpp"
+#include "functions.hpp"
+
+namespace gridtools {
+    namespace reduction {
+        namespace cpu_reproducible_impl_ {
+            // number of the independent partial results within a chunk; should be a multiple of the SIMD width
+            constexpr size_t lanes = 16;
+            // number of the elements in a chunk; should be a multiple of `lanes`
+            constexpr size_t chunk_size = 4096;
+
+            static_assert(chunk_size % lanes == 0, GT_INTERNAL_ERROR);
+
+            template <class F, class T>
+            T tree_reduce(F f, T *data, size_t n) {
+                assert(n);
+                for (size_t stride = 1; stride < n; stride *= 2)
+                    for (size_t i = 0; i + stride < n; i += 2 * stride)
+                        data[i] = f(data[i], data[i + stride]);
+                return data[0];
+            }
+
+            template <class F, class T>
+            T chunk_reduce(F f, T const &neutral, T const *buff, size_t n) {
+                assert(n % lanes == 0);
+                T acc[lanes];
+                for (size_t l = 0; l != lanes; ++l)
+                    acc[l] = neutral;
+                for (size_t i = 0; i != n; i += lanes)
+#pragma omp simd
+                    for (size_t l = 0; l < lanes; ++l)
+                        acc[l] = f(acc[l], buff[i + l]);
+                return tree_reduce(f, acc, lanes);
+            }
+
+            template <class T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+            T chunk_reduce(plus f, T const &neutral, T const *buff, size_t n) {
+                assert(n % lanes == 0);
+                T sum[lanes];
+                T err[lanes];
+                for (size_t l = 0; l != lanes; ++l) {
+                    sum[l] = neutral;
+                    err[l] = 0;
+                }
+                for (size_t i = 0; i != n; i += lanes)
+#pragma omp simd
+                    for (size_t l = 0; l < lanes; ++l) {
+                        T y = buff[i + l] - err[l];
+                        T t = sum[l] + y;
+                        err[l] = (t - sum[l]) - y;
+                        sum[l] = t;
+                    }
+                for (size_t l = 0; l != lanes; ++l)
+                    sum[l] -= err[l];
+                return tree_reduce(f, sum, lanes);
+            }
+        } // namespace cpu_reproducible_impl_
+
+        /**
+         *  A CPU reduction backend which result doesn't depend on the number of threads and on the scheduling.
+         *
+         *  The buffer is split into chunks of a fixed size. Each chunk is reduced into `lanes` independent partial
+         *  results (which the compiler maps to SIMD registers); the partial results are then combined in a fixed
+         *  pairwise tree. The results of the chunks are combined in the same way. Only the reduction of the chunks is
+         *  parallel, so the order of the operations is fully determined by the buffer size.
+         *
+         *  Floating point sums are additionally compensated (Kahan) within the chunks.
+         */
+        struct cpu_reproducible {};
+
+        template <class F, class T>
+        T reduction_reduce(cpu_reproducible, T res, F f, T const *buff, size_t n) {
+            using namespace cpu_reproducible_impl_;
+            size_t chunks = (n + chunk_size - 1) / chunk_size;
+            if (!chunks)
+                return res;
+            std::unique_ptr<T[]> partial(new T[chunks]);
+#pragma omp parallel for
+            for (size_t c = 0; c < chunks; ++c) {
+                size_t first = c * chunk_size;
+                partial[c] = chunk_reduce(f, res, buff + first, std::min(chunk_size, n - first));
+            }
+            return tree_reduce(f, partial.get(), chunks);
+        }
+
+        // the buffer is padded with the neutral values up to the multiple of the number of lanes
+        inline size_t reduction_round_size(cpu_reproducible, size_t size) {
+            using cpu_reproducible_impl_::lanes;
+            return (size + lanes - 1) / lanes * lanes;
+        }
+        inline size_t reduction_allocation_size(cpu_reproducible, size_t size) { return size; }
+
+        template <class T>
+        void reduction_fill(cpu_reproducible,
+            T const &val,
+            T *ptr,
+            size_t rows,
+            size_t row_size,
+            size_t row_stride,
+            size_t rounded_size) {
+            if (rows > 1 && row_size != row_stride) {
+#pragma omp parallel for
+                for (size_t r = 0; r < rows - 1; ++r)
+                    std::fill(ptr + r * row_stride + row_size, ptr + (r + 1) * row_stride, val);
+            }
+            std::fill(ptr + (rows ? (rows - 1) * row_stride + row_size : 0), ptr + rounded_size, val);
+        }
+    } // namespace reduction
+} // namespace gridtools
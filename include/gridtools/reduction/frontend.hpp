@@ -9,17 +9,21 @@
  */
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <cstdlib>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
+#include "../common/array.hpp"
 #include "../common/tuple.hpp"
 #include "../common/tuple_util.hpp"
 #include "../meta.hpp"
 #include "../sid/allocator.hpp"
 #include "../storage/traits.hpp"
+#include "functions.hpp"
 
 namespace gridtools {
     namespace reduction {
@@ -32,6 +36,67 @@ namespace gridtools {
             template <class Sizes>
             using zeros_type = decltype(zeros(std::declval<Sizes const &>()));
 
+            // the data without the padding holes: `count` rows of `size` elements that start `stride` elements apart
+            struct rows {
+                size_t count;
+                size_t size;
+                size_t stride;
+            };
+
+            // the holes can only appear as the padding of the innermost (stride one) dimension
+            template <class StorageTraits, class T, class Lengths>
+            rows make_rows(Lengths const &lengths, size_t data_size) {
+                if (!data_size)
+                    return {0, 0, 0};
+                if (!storage::traits::has_holes<StorageTraits, T>(lengths))
+                    return {1, data_size, data_size};
+                constexpr size_t dims = tuple_util::size<Lengths>::value;
+                constexpr size_t align = storage::traits::elem_alignment<StorageTraits, T>;
+                using layout_t = storage::traits::layout_type<StorageTraits, dims>;
+                size_t size = tuple_util::get<layout_t::find(dims - 1)>(lengths);
+                size_t stride = (size + align - 1) / align * align;
+                return {(data_size - size) / stride + 1, size, stride};
+            }
+
+            /**
+             *  The result of the location reductions: the value of the element and its multidimensional index.
+             */
+            template <class T, size_t N>
+            struct location {
+                T value;
+                array<int_t, N> index;
+            };
+
+            // recovers the index from the offset in the buffer, going from the outermost (largest stride) dimension
+            template <size_t N, class Strides, class Sizes>
+            array<int_t, N> make_index(size_t offset, Strides const &strides, Sizes const &sizes) {
+                array<int_t, N> res = {};
+                std::array<size_t, N> s;
+                std::array<size_t, N> l;
+                std::array<bool, N> done = {};
+                size_t d = 0;
+                tuple_util::for_each(
+                    [&](auto stride, auto size) {
+                        s[d] = stride;
+                        l[d] = size;
+                        ++d;
+                    },
+                    strides,
+                    sizes);
+                for (size_t n = 0; n != N; ++n) {
+                    size_t outer = N;
+                    for (d = 0; d != N; ++d)
+                        if (!done[d] && l[d] > 1 && (outer == N || s[d] > s[outer]))
+                            outer = d;
+                    if (outer == N)
+                        break;
+                    done[outer] = true;
+                    res[outer] = offset / s[outer];
+                    offset %= s[outer];
+                }
+                return res;
+            }
+
             template <class Backend, class T, class Origin, class Strides, class StridesKind, class Sizes>
             struct reducible {
                 std::shared_ptr<void> m_alloc;
@@ -40,6 +105,18 @@ namespace gridtools {
                 size_t m_size;
                 Strides m_strides;
                 Sizes m_sizes;
+                rows m_rows;
+
+                /**
+                 *  Prepares the reducible for the reuse with another neutral value (f.e. switching from `plus` to
+                 *  `max`). Only the padding is refilled, the data is left as is. The reuse with the same neutral value
+                 *  doesn't need that: the reductions don't modify the buffer, so a reducible can be written by the
+                 *  stencils and reduced any number of times without any setup cost.
+                 */
+                void rearm(T const &neutral) {
+                    neutral_value = neutral;
+                    reduction_fill(Backend(), neutral, m_origin(), m_rows.count, m_rows.size, m_rows.stride, m_size);
+                }
 
                 template <class F>
                 auto reduce(F f) const {
@@ -47,6 +124,40 @@ namespace gridtools {
                     return reduction_reduce(Backend(), neutral_value, f, m_origin(), m_size);
                 }
 
+                /**
+                 *  Computes several reductions in a single pass over the buffer and returns the results as a tuple:
+                 *  \code
+                 *  auto [sum, lo, hi] = r.reduce(plus(), min(), max());
+                 *  \endcode
+                 *  The initial values are taken from `reduction_identity`. The padding holes are skipped, so the
+                 *  neutral value of the reducible doesn't matter here.
+                 */
+                template <class F, class... Fs, std::enable_if_t<sizeof...(Fs) != 0, int> = 0>
+                auto reduce(F f, Fs... fs) const {
+                    using id_t = meta::lazy::id<T>;
+                    return reduction_reduce_fused(Backend(),
+                        tuple(reduction_identity(f, id_t()), reduction_identity(fs, id_t())...),
+                        tuple(f, fs...),
+                        m_origin(),
+                        m_rows.count,
+                        m_rows.size,
+                        m_rows.stride);
+                }
+
+                /**
+                 *  Finds the location of the element preferred by `f` (`reduction::argmin`, `reduction::argmax` or
+                 *  `reduction::first_nan`). Returns an empty optional if there is no such element.
+                 */
+                template <class F>
+                std::optional<location<T, tuple_util::size<Sizes>::value>> locate(F f) const {
+                    T const *ptr = m_origin();
+                    size_t offset = reduction_locate(Backend(), f, ptr, m_rows.count, m_rows.size, m_rows.stride);
+                    if (offset == not_found || !f.accepts(ptr[offset]))
+                        return {};
+                    constexpr size_t n = tuple_util::size<Sizes>::value;
+                    return location<T, n>{ptr[offset], make_index<n>(offset, m_strides, m_sizes)};
+                }
+
                 friend Strides sid_get_strides(reducible const &obj) { return obj.m_strides; }
                 friend Origin sid_get_origin(reducible const &obj) { return {obj.m_origin}; }
                 friend zeros_type<Sizes> sid_get_lower_bounds(reducible const &obj) { return zeros(obj.m_sizes); }
@@ -71,12 +182,14 @@ namespace gridtools {
                 size_t rounded_size = reduction_round_size(Backend(), data_size);
                 size_t allocation_size = reduction_allocation_size(Backend(), rounded_size);
                 auto origin = allocate(alloc, meta::lazy::id<T>(), allocation_size);
+                auto data_rows = make_rows<StorageTraits, T>(lengths, data_size);
                 reduction_fill(Backend(),
                     neutral_value,
                     origin(),
-                    data_size,
-                    rounded_size,
-                    storage::traits::has_holes<StorageTraits, T>(lengths));
+                    data_rows.count,
+                    data_rows.size,
+                    data_rows.stride,
+                    rounded_size);
                 return reducible<Backend,
                     T,
                     decltype(origin),
@@ -87,9 +200,11 @@ namespace gridtools {
                     std::move(origin),
                     rounded_size,
                     std::move(strides),
-                    std::move(lengths)};
+                    std::move(lengths),
+                    data_rows};
             }
         } // namespace frontend_impl_
+        using frontend_impl_::location;
         using frontend_impl_::make_reducible;
     } // namespace reduction
 } // namespace gridtools
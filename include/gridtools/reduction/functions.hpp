@@ -9,7 +9,12 @@
  */
 #pragma once
 
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
 #include "../common/host_device.hpp"
+#include "../meta/id.hpp"
 
 namespace gridtools {
     namespace reduction {
@@ -55,5 +60,81 @@ namespace gridtools {
                 return x ^ y;
             }
         };
+
+        /**
+         *  The identity elements of the functions above. They are used as the initial values of the fused
+         *  reductions (see `reducible::reduce(F, Fs...)`). User defined functions can provide their identity by
+         *  overloading `reduction_identity` in their namespace.
+         */
+        template <class T>
+        constexpr T reduction_identity(plus, meta::lazy::id<T>) {
+            return T(0);
+        }
+        template <class T>
+        constexpr T reduction_identity(mul, meta::lazy::id<T>) {
+            return T(1);
+        }
+        template <class T>
+        constexpr T reduction_identity(min, meta::lazy::id<T>) {
+            using limits_t = std::numeric_limits<T>;
+            return limits_t::has_infinity ? limits_t::infinity() : limits_t::max();
+        }
+        template <class T>
+        constexpr T reduction_identity(max, meta::lazy::id<T>) {
+            using limits_t = std::numeric_limits<T>;
+            return limits_t::has_infinity ? -limits_t::infinity() : limits_t::lowest();
+        }
+        template <class T>
+        constexpr T reduction_identity(bitwise_and, meta::lazy::id<T>) {
+            return T(~T(0));
+        }
+        template <class T>
+        constexpr T reduction_identity(bitwise_or, meta::lazy::id<T>) {
+            return T(0);
+        }
+        template <class T>
+        constexpr T reduction_identity(bitwise_xor, meta::lazy::id<T>) {
+            return T(0);
+        }
+
+        /**
+         *  Location reductions (see `reducible::locate`).
+         *
+         *  `f(x, y)` tells if `x` is preferred over `y`; among the equally preferred elements the one with the
+         *  smallest offset in the buffer is taken. `f.accepts(x)` tells if the best element is a valid result.
+         */
+        struct argmin {
+            template <class T>
+            bool operator()(T const &x, T const &y) const {
+                return x < y || (std::isnan(y) && !std::isnan(x));
+            }
+            template <class T>
+            bool accepts(T const &) const {
+                return true;
+            }
+        };
+        struct argmax {
+            template <class T>
+            bool operator()(T const &x, T const &y) const {
+                return x > y || (std::isnan(y) && !std::isnan(x));
+            }
+            template <class T>
+            bool accepts(T const &) const {
+                return true;
+            }
+        };
+        struct first_nan {
+            template <class T>
+            bool operator()(T const &x, T const &y) const {
+                return std::isnan(x) && !std::isnan(y);
+            }
+            template <class T>
+            bool accepts(T const &x) const {
+                return std::isnan(x);
+            }
+        };
+
+        // the offset that `reduction_locate` returns if there is nothing to locate
+        constexpr size_t not_found = size_t(-1);
     } // namespace reduction
 } // namespace gridtools
@@ -0,0 +1,177 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <mpi.h>
+
+#include "functions.hpp"
+
+namespace gridtools {
+    namespace reduction {
+        namespace global_impl_ {
+            // only the exact types are mapped, the others are combined via gathering
+            template <class T>
+            struct mpi_datatype;
+
+#define GT_REDUCTION_MPI_DATATYPE(type, mpi_type)      \
+    template <>                                        \
+    struct mpi_datatype<type> {                        \
+        static MPI_Datatype get() { return mpi_type; } \
+    }
+
+            GT_REDUCTION_MPI_DATATYPE(float, MPI_FLOAT);
+            GT_REDUCTION_MPI_DATATYPE(double, MPI_DOUBLE);
+            GT_REDUCTION_MPI_DATATYPE(long double, MPI_LONG_DOUBLE);
+            GT_REDUCTION_MPI_DATATYPE(std::int8_t, MPI_INT8_T);
+            GT_REDUCTION_MPI_DATATYPE(std::int16_t, MPI_INT16_T);
+            GT_REDUCTION_MPI_DATATYPE(std::int32_t, MPI_INT32_T);
+            GT_REDUCTION_MPI_DATATYPE(std::int64_t, MPI_INT64_T);
+            GT_REDUCTION_MPI_DATATYPE(std::uint8_t, MPI_UINT8_T);
+            GT_REDUCTION_MPI_DATATYPE(std::uint16_t, MPI_UINT16_T);
+            GT_REDUCTION_MPI_DATATYPE(std::uint32_t, MPI_UINT32_T);
+            GT_REDUCTION_MPI_DATATYPE(std::uint64_t, MPI_UINT64_T);
+
+#undef GT_REDUCTION_MPI_DATATYPE
+
+            inline MPI_Op mpi_op(plus) { return MPI_SUM; }
+            inline MPI_Op mpi_op(mul) { return MPI_PROD; }
+            inline MPI_Op mpi_op(min) { return MPI_MIN; }
+            inline MPI_Op mpi_op(max) { return MPI_MAX; }
+            inline MPI_Op mpi_op(bitwise_and) { return MPI_BAND; }
+            inline MPI_Op mpi_op(bitwise_or) { return MPI_BOR; }
+            inline MPI_Op mpi_op(bitwise_xor) { return MPI_BXOR; }
+
+            template <class F, class T, class = void>
+            struct has_mpi_op : std::false_type {};
+
+            template <class F, class T>
+            struct has_mpi_op<F,
+                T,
+                std::void_t<decltype(mpi_op(std::declval<F>())), decltype(mpi_datatype<T>::get())>>
+                : std::true_type {};
+
+            /**
+             *  The handle of the global reduction in flight.
+             *
+             *  Either holds the local value and the result of `MPI_Iallreduce` or the gathered values of all ranks
+             *  followed by the local one. The buffer is heap allocated, so that the handle can be moved while MPI
+             *  writes into it.
+             */
+            template <class T, class F>
+            class pending_reduction {
+                static_assert(
+                    std::is_trivially_copyable_v<T>, "Global reductions support only trivially copyable types.");
+
+                F m_f;
+                int m_ranks;
+                std::unique_ptr<T[]> m_buff;
+                MPI_Request m_request = MPI_REQUEST_NULL;
+
+              public:
+                pending_reduction(MPI_Comm comm, T const &local, F f, bool ordered) : m_f(std::move(f)) {
+                    if (!ordered && has_mpi_op<F, T>::value) {
+                        m_ranks = 0;
+                        m_buff.reset(new T[2]);
+                        m_buff[0] = local;
+                        if constexpr (has_mpi_op<F, T>::value)
+                            MPI_Iallreduce(
+                                &m_buff[0], &m_buff[1], 1, mpi_datatype<T>::get(), mpi_op(m_f), comm, &m_request);
+                    } else {
+                        MPI_Comm_size(comm, &m_ranks);
+                        m_buff.reset(new T[m_ranks + 1]);
+                        m_buff[m_ranks] = local;
+                        MPI_Iallgather(
+                            &m_buff[m_ranks], sizeof(T), MPI_BYTE, &m_buff[0], sizeof(T), MPI_BYTE, comm, &m_request);
+                    }
+                }
+
+                pending_reduction(pending_reduction &&other)
+                    : m_f(std::move(other.m_f)), m_ranks(other.m_ranks), m_buff(std::move(other.m_buff)),
+                      m_request(std::exchange(other.m_request, MPI_REQUEST_NULL)) {}
+
+                pending_reduction &operator=(pending_reduction &&) = delete;
+
+                ~pending_reduction() {
+                    if (m_request != MPI_REQUEST_NULL)
+                        MPI_Wait(&m_request, MPI_STATUS_IGNORE);
+                }
+
+                /**
+                 *  Checks if the communication is completed, `wait` doesn't block after that.
+                 */
+                bool test() {
+                    int flag;
+                    MPI_Test(&m_request, &flag, MPI_STATUS_IGNORE);
+                    return flag;
+                }
+
+                /**
+                 *  Waits for the completion and returns the result. Should be called only once.
+                 */
+                T wait() {
+                    MPI_Wait(&m_request, MPI_STATUS_IGNORE);
+                    if (!m_ranks)
+                        return m_buff[1];
+                    T res = m_buff[0];
+                    for (int i = 1; i < m_ranks; ++i)
+                        res = m_f(res, m_buff[i]);
+                    return res;
+                }
+            };
+
+            /**
+             *  Global (over all ranks of the communicator) reductions of the reducibles.
+             *
+             *  \code
+             *  auto pending = reduction::ireduce_global(comm, r, reduction::plus());
+             *  run(...); // some independent computation
+             *  auto res = pending.wait();
+             *  \endcode
+             *
+             *  The local reduction is done by the reducible backend. The per rank results are combined with
+             *  `MPI_Iallreduce` if MPI has a predefined operation for the function and the type, otherwise they are
+             *  gathered to all ranks and combined in rank order. The `*_ordered` variants always do the latter, hence
+             *  their result is the same on all ranks and for all MPI implementations; together with the
+             *  `cpu_reproducible` backend this makes the global reductions bitwise reproducible.
+             */
+            template <class Reducible, class F>
+            auto ireduce_global(MPI_Comm comm, Reducible const &reducible, F f) {
+                using res_t = decltype(reducible.reduce(f));
+                return pending_reduction<res_t, F>(comm, reducible.reduce(f), f, false);
+            }
+
+            template <class Reducible, class F>
+            auto ireduce_global_ordered(MPI_Comm comm, Reducible const &reducible, F f) {
+                using res_t = decltype(reducible.reduce(f));
+                return pending_reduction<res_t, F>(comm, reducible.reduce(f), f, true);
+            }
+
+            template <class Reducible, class F>
+            auto reduce_global(MPI_Comm comm, Reducible const &reducible, F f) {
+                return ireduce_global(comm, reducible, f).wait();
+            }
+
+            template <class Reducible, class F>
+            auto reduce_global_ordered(MPI_Comm comm, Reducible const &reducible, F f) {
+                return ireduce_global_ordered(comm, reducible, f).wait();
+            }
+        } // namespace global_impl_
+        using global_impl_::ireduce_global;
+        using global_impl_::ireduce_global_ordered;
+        using global_impl_::pending_reduction;
+        using global_impl_::reduce_global;
+        using global_impl_::reduce_global_ordered;
+    } // namespace reduction
+} // namespace gridtools
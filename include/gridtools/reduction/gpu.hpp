@@ -363,9 +363,13 @@ namespace gridtools {
                     warp_size / 64);
             }
 
+            // fills the padding between the rows and after the data
             template <class T>
-            __global__ void fill(T *dst, T val) {
-                dst[blockIdx.x * blockDim.x + threadIdx.x] = val;
+            __global__ void fill_padding(
+                T *dst, T val, size_t row_size, size_t row_stride, size_t data_size, size_t rounded_size) {
+                size_t i = blockIdx.x * blockDim.x + threadIdx.x;
+                if (i < rounded_size && (i >= data_size || i % row_stride >= row_size))
+                    dst[i] = val;
             }
 
             struct gpu {};
@@ -404,11 +408,14 @@ namespace gridtools {
             }
 
             template <class T>
-            void reduction_fill(gpu, T const &val, T *dst, size_t data_size, size_t rounded_size, bool has_holes) {
-                if (!has_holes && data_size == rounded_size)
+            void reduction_fill(
+                gpu, T const &val, T *dst, size_t rows, size_t row_size, size_t row_stride, size_t rounded_size) {
+                size_t data_size = rows ? (rows - 1) * row_stride + row_size : 0;
+                if (row_size == row_stride && data_size == rounded_size)
                     return;
-                auto threads = std::gcd(rounded_size, max_threads());
-                fill<<<rounded_size / threads, threads>>>(dst, val);
+                size_t threads = max_threads();
+                fill_padding<<<(rounded_size + threads - 1) / threads, threads>>>(
+                    dst, val, row_size, row_stride, data_size, rounded_size);
                 GT_CUDA_CHECK(cudaGetLastError());
             }
         } // namespace gpu_backend
@@ -11,6 +11,10 @@
 
 #include <cstdlib>
 
+#include "../common/tuple.hpp"
+#include "../common/tuple_util.hpp"
+#include "functions.hpp"
+
 namespace gridtools {
     namespace reduction {
         struct naive {};
@@ -22,13 +26,38 @@ namespace gridtools {
             return res;
         }
 
+        template <class... Ts, class... Fs, class T>
+        tuple<Ts...> reduction_reduce_fused(
+            naive, tuple<Ts...> res, tuple<Fs...> fs, T const *buff, size_t rows, size_t row_size, size_t row_stride) {
+            for (size_t r = 0; r != rows; ++r)
+                for (size_t i = 0; i != row_size; ++i)
+                    tuple_util::for_each(
+                        [x = buff[r * row_stride + i]](auto f, auto &acc) { acc = f(acc, x); }, fs, res);
+            return res;
+        }
+
+        template <class F, class T>
+        size_t reduction_locate(naive, F f, T const *buff, size_t rows, size_t row_size, size_t row_stride) {
+            size_t res = not_found;
+            for (size_t r = 0; r != rows; ++r)
+                for (size_t i = 0; i != row_size; ++i) {
+                    size_t offset = r * row_stride + i;
+                    if (res == not_found || f(buff[offset], buff[res]))
+                        res = offset;
+                }
+            return res;
+        }
+
         inline size_t reduction_round_size(naive, size_t size) { return size; }
         inline size_t reduction_allocation_size(naive, size_t size) { return size; }
 
         template <class T>
         void reduction_fill(
-            naive, T const &val, T *ptr, size_t /*data_size*/, size_t rounded_size, bool /*has_holes*/) {
-            for (size_t i = 0; i != rounded_size; ++i)
+            naive, T const &val, T *ptr, size_t rows, size_t row_size, size_t row_stride, size_t rounded_size) {
+            for (size_t r = 0; r + 1 < rows; ++r)
+                for (size_t i = r * row_stride + row_size; i != (r + 1) * row_stride; ++i)
+                    ptr[i] = val;
+            for (size_t i = rows ? (rows - 1) * row_stride + row_size : 0; i < rounded_size; ++i)
                 ptr[i] = val;
         }
     } // namespace reduction
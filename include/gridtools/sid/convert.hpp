@@ -0,0 +1,143 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "../common/host_device.hpp"
+#include "concept.hpp"
+#include "synthetic.hpp"
+
+namespace gridtools {
+    namespace sid {
+        namespace convert_impl_ {
+            /**
+             *  A proxy reference: reads are converted to `T`, writes are converted back to the stored type.
+             */
+            template <class T, class Ref>
+            class reference {
+                using stored_t = std::remove_reference_t<Ref>;
+                Ref m_ref;
+
+              public:
+                GT_FUNCTION constexpr reference(Ref ref) : m_ref(ref) {}
+                reference(reference const &) = default;
+
+                GT_FUNCTION constexpr operator T() const { return static_cast<T>(m_ref); }
+
+                GT_FUNCTION reference const &operator=(T const &val) const {
+                    m_ref = static_cast<stored_t>(val);
+                    return *this;
+                }
+                GT_FUNCTION reference const &operator=(reference const &other) const {
+                    return *this = static_cast<T>(other);
+                }
+                GT_FUNCTION reference const &operator+=(T const &val) const { return *this = T(*this) + val; }
+                GT_FUNCTION reference const &operator-=(T const &val) const { return *this = T(*this) - val; }
+                GT_FUNCTION reference const &operator*=(T const &val) const { return *this = T(*this) * val; }
+                GT_FUNCTION reference const &operator/=(T const &val) const { return *this = T(*this) / val; }
+            };
+
+            template <class T>
+            struct value_type {
+                using type = T;
+            };
+
+            template <class T, class Ref>
+            struct value_type<reference<T, Ref>> {
+                using type = T;
+            };
+
+            template <class Ref>
+            using is_writable =
+                std::bool_constant<std::is_lvalue_reference_v<Ref> && !std::is_const_v<std::remove_reference_t<Ref>>>;
+
+            template <class T, class Ref, std::enable_if_t<is_writable<Ref>::value, int> = 0>
+            GT_FUNCTION constexpr reference<T, Ref> convert_ref(Ref &&ref) {
+                return {ref};
+            }
+
+            template <class T, class Ref, std::enable_if_t<!is_writable<Ref>::value, int> = 0>
+            GT_FUNCTION constexpr T convert_ref(Ref &&ref) {
+                return static_cast<T>(ref);
+            }
+
+            template <class T, class Ptr, class PtrDiff>
+            struct ptr {
+                Ptr m_impl;
+
+                GT_FUNCTION constexpr decltype(auto) operator*() const { return convert_ref<T>(*m_impl); }
+
+                friend GT_FUNCTION constexpr ptr operator+(ptr const &obj, PtrDiff const &diff) {
+                    return {obj.m_impl + diff};
+                }
+
+                template <class Stride, class Offset>
+                friend GT_FUNCTION void sid_shift(ptr &obj, Stride const &stride, Offset offset) {
+                    shift(obj.m_impl, stride, offset);
+                }
+            };
+
+            template <class T, class PtrHolder, class PtrDiff>
+            struct ptr_holder {
+                PtrHolder m_impl;
+
+                GT_FUNCTION constexpr auto operator()() const {
+                    return ptr<T, std::decay_t<decltype(m_impl())>, PtrDiff>{m_impl()};
+                }
+
+                friend GT_FUNCTION constexpr ptr_holder operator+(ptr_holder const &obj, PtrDiff const &diff) {
+                    return {obj.m_impl + diff};
+                }
+            };
+        } // namespace convert_impl_
+
+        /**
+         *   The type of the values that `Sid` reads and writes: the `element_type` with the proxy references of
+         *   `sid::convert` replaced by the type they convert to.
+         */
+        template <class Sid>
+        using value_type = typename convert_impl_::value_type<element_type<Sid>>::type;
+
+        /**
+         *   Returns a `SID` that has the same strides, bounds and strides kind as `sid`, but which elements are
+         *   converted to `T` when dereferenced.
+         *
+         *   If the original elements are writable, the reference type of the result is a proxy that converts the
+         *   assigned `T` value back to the original element type. Otherwise the reference type is `T` itself.
+         *
+         *   The typical use case is mixed precision: data is kept in memory in a compact type (`float`, `bfloat16`)
+         *   while the computation is done in a wide type (`double`):
+         *
+         *   \code
+         *   auto in = builder.type<float const>().initializer(...)();
+         *   auto out = builder.type<float>()();
+         *   run(spec, backend, grid, sid::convert<double>(in), sid::convert<double>(out));
+         *   \endcode
+         *
+         *   Note that the result doesn't own the original sid, like with other `sid::synthetic`s the original
+         *   should outlive the result.
+         */
+        template <class T, class Sid>
+        auto convert(Sid &&sid) {
+            using sid_t = std::remove_reference_t<Sid>;
+            using ptr_diff_t = ptr_diff_type<sid_t>;
+            using ptr_holder_t = convert_impl_::ptr_holder<T, ptr_holder_type<sid_t>, ptr_diff_t>;
+            return synthetic()
+                .set<property::origin>(ptr_holder_t{get_origin(sid)})
+                .template set<property::strides>(get_strides(sid))
+                .template set<property::ptr_diff, ptr_diff_t>()
+                .template set<property::strides_kind, strides_kind<sid_t>>()
+                .template set<property::lower_bounds>(get_lower_bounds(sid))
+                .template set<property::upper_bounds>(get_upper_bounds(sid));
+        }
+    } // namespace sid
+} // namespace gridtools
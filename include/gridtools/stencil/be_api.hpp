@@ -11,6 +11,7 @@
 
 #include <type_traits>
 
+#include "../common/defs.hpp"
 #include "../common/for_each.hpp"
 #include "../common/host_device.hpp"
 #include "../common/hymap.hpp"
@@ -411,6 +412,20 @@ namespace gridtools {
             using make_split_view = meta::rename<aggregated_view,
                 meta::transform<make_split_view_item, meta::flatten<meta::transform<fuse_stage_rows, Matrices>>>>;
 
+            /**
+             *  An epilogue is a callable that is executed by the backend after the stages (see `run_with_epilogue`).
+             *
+             *  Backends which execute the stages block by block may provide an overload of
+             *  `gridtools_backend_entry_point` with the additional epilogue argument and call
+             *  `epilogue(i_first, j_first, i_size, j_size)` for each horizontal block (in the compute domain
+             *  coordinates) right after its last stage. The blocks should cover the compute domain without overlaps and
+             *  may be processed concurrently. For the other backends `epilogue()` is called once after the computation.
+             */
+            struct no_epilogue {
+                void operator()() const {}
+                void operator()(int_t, int_t, int_t, int_t) const {}
+            };
+
             using core::is_backward;
             using core::is_forward;
             using core::is_parallel;
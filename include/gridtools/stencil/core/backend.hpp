@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <functional>
+#include <type_traits>
 #include <utility>
 
 #include "../../common/for_each.hpp"
@@ -33,10 +34,30 @@ namespace gridtools {
                         std::move(data_stores));
                 }
 
+                template <class Backend, class Spec, class Grid, class DataStores, class Epilogue>
+                auto call_with_epilogue(
+                    Backend &&be, Spec spec, Grid const &grid, DataStores data_stores, Epilogue const &epilogue, int)
+                    -> decltype(gridtools_backend_entry_point(
+                        std::forward<Backend>(be), spec, grid, std::move(data_stores), epilogue)) {
+                    gridtools_backend_entry_point(
+                        std::forward<Backend>(be), spec, grid, std::move(data_stores), epilogue);
+                }
+
+                // the backend doesn't support epilogues, run it after the computation
+                template <class Backend, class Spec, class Grid, class DataStores, class Epilogue>
+                void call_with_epilogue(
+                    Backend &&be, Spec spec, Grid const &grid, DataStores data_stores, Epilogue const &epilogue, long) {
+                    gridtools_backend_entry_point(std::forward<Backend>(be), spec, grid, std::move(data_stores));
+                    epilogue();
+                }
+
                 template <class Spec>
                 struct call_entry_point_f {
-                    template <class Backend, class Grid, class DataStores>
-                    void operator()(Backend &&be, Grid const &grid, DataStores data_stores) const {
+                    template <class Backend, class Grid, class DataStores, class Epilogue = be_api::no_epilogue>
+                    void operator()(Backend &&be,
+                        Grid const &grid,
+                        DataStores data_stores,
+                        Epilogue const &epilogue = be_api::no_epilogue()) const {
                         using be_spec_t = convert_fe_to_be_spec<Spec, typename Grid::interval_t, DataStores>;
 #ifndef NDEBUG
                         for_each<be_api::make_fused_view<be_spec_t>>([&](auto matrix) {
@@ -45,8 +66,18 @@ namespace gridtools {
                             });
                         });
 #endif
-                        gridtools_backend_entry_point(
-                            std::forward<Backend>(be), be_spec_t(), grid, shift_origin(grid, std::move(data_stores)));
+                        if constexpr (std::is_same_v<Epilogue, be_api::no_epilogue>)
+                            gridtools_backend_entry_point(std::forward<Backend>(be),
+                                be_spec_t(),
+                                grid,
+                                shift_origin(grid, std::move(data_stores)));
+                        else
+                            call_with_epilogue(std::forward<Backend>(be),
+                                be_spec_t(),
+                                grid,
+                                shift_origin(grid, std::move(data_stores)),
+                                epilogue,
+                                0);
                     }
                 };
             } // namespace backend_impl_
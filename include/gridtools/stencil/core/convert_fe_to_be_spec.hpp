@@ -13,6 +13,7 @@
 
 #include "../../common/defs.hpp"
 #include "../../meta.hpp"
+#include "../../sid/convert.hpp"
 #include "../be_api.hpp"
 #include "cache_info.hpp"
 #include "compute_extents_metafunctions.hpp"
@@ -31,7 +32,7 @@ namespace gridtools {
                 template <class Plh, class DataStores, bool = is_tmp_arg<Plh>::value>
                 struct get_data_type {
                     using sid_t = decltype(at_key<Plh>(std::declval<DataStores>()));
-                    using type = sid::element_type<sid_t>;
+                    using type = sid::value_type<sid_t>;
                 };
 
                 template <class Plh, class DataStores>
@@ -32,7 +32,15 @@
 namespace gridtools {
     namespace stencil {
         namespace cpu_ifirst_backend {
-            template <class ThreadPool = thread_pool::omp>
+            /**
+             *  The domain is split into one tile per thread.
+             *  If `IBlockSize` or `JBlockSize` are not zero, the tiles are split further into blocks of (at most)
+             *  that size and all stages are executed block by block. That makes the temporaries smaller, so that
+             *  for large multi-stage specs they can stay in L1/L2 cache.
+             */
+            template <class ThreadPool = thread_pool::omp,
+                class IBlockSize = integral_constant<int_t, 0>,
+                class JBlockSize = integral_constant<int_t, 0>>
             struct cpu_ifirst {
                 template <class Spec, class Grid, class DataStores>
                 friend void gridtools_backend_entry_point(
@@ -49,7 +57,7 @@ namespace gridtools {
 
                     tmp_allocator alloc;
 
-                    execinfo info(thread_pool_t(), grid);
+                    execinfo info(thread_pool_t(), grid, IBlockSize::value, JBlockSize::value);
 
                     using tmp_plh_map_t = be_api::remove_caches_from_plh_map<typename stages_t::tmp_plh_map_t>;
                     auto temporaries = be_api::make_data_stores(tmp_plh_map_t(),
@@ -90,7 +98,7 @@ namespace gridtools {
                         },
                         meta::rename<tuple, stages_t>());
 
-                    run_loops<thread_pool_t>(fuse_all_t(), grid, std::move(loops));
+                    run_loops<thread_pool_t>(fuse_all_t(), info, grid.k_size(), std::move(loops));
                 }
             };
         } // namespace cpu_ifirst_backend
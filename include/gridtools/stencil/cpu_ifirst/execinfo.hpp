@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <cassert>
+
 #include "../../common/defs.hpp"
 #include "../../common/host_device.hpp"
 #include "../../thread_pool/concept.hpp"
@@ -42,35 +44,70 @@ namespace gridtools {
 
             /**
              * @brief Helper class for block handling.
+             *
+             * The domain is split into tiles, one per thread. Each tile is split further into blocks. All stages are
+             * executed block by block, so the temporaries (which are allocated per block) stay in cache if the block
+             * is small enough. By default a tile consists of a single block.
              */
             class execinfo {
                 int_t m_i_grid_size, m_j_grid_size;
                 int_t m_i_block_size, m_j_block_size;
                 int_t m_i_blocks, m_j_blocks;
+                int_t m_i_tile_blocks, m_j_tile_blocks;
+                int_t m_i_tiles, m_j_tiles;
 
                 GT_FORCE_INLINE static int_t clamped_block_size(
                     int_t grid_size, int_t block_index, int_t block_size, int_t blocks) {
                     return (block_index == blocks - 1) ? grid_size - block_index * block_size : block_size;
                 }
 
+                GT_FORCE_INLINE static int_t div_ceil(int_t a, int_t b) { return (a + b - 1) / b; }
+
               public:
+                /**
+                 * @param i_block_size, j_block_size Maximal block sizes; zero means that the block is the whole tile.
+                 */
                 template <class ThreadPool, class Grid>
-                GT_FORCE_INLINE execinfo(ThreadPool, const Grid &grid)
+                GT_FORCE_INLINE execinfo(ThreadPool, const Grid &grid, int_t i_block_size = 0, int_t j_block_size = 0)
                     : m_i_grid_size(grid.i_size()), m_j_grid_size(grid.j_size()) {
                     int_t threads = thread_pool::get_max_threads(ThreadPool());
 
                     // if domain is large enough (relative to the number of threads),
                     // we split only along j-axis (for prefetching reasons)
                     // for smaller domains we also split along i-axis
-                    m_j_block_size = (m_j_grid_size + threads - 1) / threads;
-                    m_j_blocks = (m_j_grid_size + m_j_block_size - 1) / m_j_block_size;
-                    int_t max_i_blocks = threads / m_j_blocks;
-                    m_i_block_size = (m_i_grid_size + max_i_blocks - 1) / max_i_blocks;
-                    m_i_blocks = (m_i_grid_size + m_i_block_size - 1) / m_i_block_size;
+                    int_t j_tile_size = div_ceil(m_j_grid_size, threads);
+                    int_t j_tiles = div_ceil(m_j_grid_size, j_tile_size);
+                    int_t max_i_tiles = threads / j_tiles;
+                    int_t i_tile_size = div_ceil(m_i_grid_size, max_i_tiles);
+
+                    m_i_block_size = i_block_size > 0 && i_block_size < i_tile_size ? i_block_size : i_tile_size;
+                    m_j_block_size = j_block_size > 0 && j_block_size < j_tile_size ? j_block_size : j_tile_size;
+                    m_i_blocks = div_ceil(m_i_grid_size, m_i_block_size);
+                    m_j_blocks = div_ceil(m_j_grid_size, m_j_block_size);
+
+                    // tiles consist of whole blocks
+                    m_i_tile_blocks = div_ceil(i_tile_size, m_i_block_size);
+                    m_j_tile_blocks = div_ceil(j_tile_size, m_j_block_size);
+                    m_i_tiles = div_ceil(m_i_blocks, m_i_tile_blocks);
+                    m_j_tiles = div_ceil(m_j_blocks, m_j_tile_blocks);
 
                     assert(m_i_block_size > 0 && m_j_block_size > 0);
                 }
 
+                /**
+                 * @brief Calls `fun(i_block_index, j_block_index)` for all blocks of the given tile.
+                 */
+                template <class Fun>
+                GT_FORCE_INLINE void for_each_block(int_t i_tile_index, int_t j_tile_index, Fun &&fun) const {
+                    int_t i_first = i_tile_index * m_i_tile_blocks;
+                    int_t j_first = j_tile_index * m_j_tile_blocks;
+                    int_t i_last = i_first + m_i_tile_blocks < m_i_blocks ? i_first + m_i_tile_blocks : m_i_blocks;
+                    int_t j_last = j_first + m_j_tile_blocks < m_j_blocks ? j_first + m_j_tile_blocks : m_j_blocks;
+                    for (int_t j = j_first; j < j_last; ++j)
+                        for (int_t i = i_first; i < i_last; ++i)
+                            fun(i, j);
+                }
+
                 /**
                  * @brief Computes the effective (clamped) block size and position for k-serial stencils.
                  *
@@ -109,6 +146,11 @@ namespace gridtools {
                 /** @brief Number of blocks along j-axis. */
                 GT_FORCE_INLINE int_t j_blocks() const { return m_j_blocks; }
 
+                /** @brief Number of tiles along i-axis. */
+                GT_FORCE_INLINE int_t i_tiles() const { return m_i_tiles; }
+                /** @brief Number of tiles along j-axis. */
+                GT_FORCE_INLINE int_t j_tiles() const { return m_j_tiles; }
+
                 /** @brief Unclamped block size along i-axis. */
                 GT_FORCE_INLINE int_t i_block_size() const { return m_i_block_size; }
                 /** @brief Unclamped block size along j-axis. */
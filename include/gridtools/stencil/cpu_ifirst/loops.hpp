@@ -97,20 +97,19 @@ namespace gridtools {
                     };
                 }
 
-                template <class ThreadPool, class Grid, class Loops>
-                void run_loops(std::true_type, Grid const &grid, Loops loops) {
-                    execinfo info(ThreadPool(), grid);
-                    int_t i_blocks = info.i_blocks();
-                    int_t j_blocks = info.j_blocks();
-                    int_t k_size = grid.k_size();
+                template <class ThreadPool, class Loops>
+                void run_loops(std::true_type, execinfo const &info, int_t k_size, Loops loops) {
                     thread_pool::parallel_for_loop(
                         ThreadPool(),
-                        [&](auto i, auto k, auto j) {
-                            tuple_util::for_each([block = info.block(i, j, k)](auto &&loop) { loop(block); }, loops);
+                        [&](auto i_tile, auto k, auto j_tile) {
+                            info.for_each_block(i_tile, j_tile, [&](int_t i, int_t j) {
+                                tuple_util::for_each(
+                                    [block = info.block(i, j, k)](auto &&loop) { loop(block); }, loops);
+                            });
                         },
-                        i_blocks,
+                        info.i_tiles(),
                         k_size,
-                        j_blocks);
+                        info.j_tiles());
                 }
 
                 template <class ThreadPool, class Stage, class Grid, class Composite, class KSizes>
@@ -149,16 +148,17 @@ namespace gridtools {
                     };
                 }
 
-                template <class ThreadPool, class Grid, class Loops>
-                void run_loops(std::false_type, Grid const &grid, Loops loops) {
-                    execinfo info(ThreadPool(), grid);
+                template <class ThreadPool, class Loops>
+                void run_loops(std::false_type, execinfo const &info, int_t, Loops loops) {
                     thread_pool::parallel_for_loop(
                         ThreadPool(),
-                        [&](auto i, auto j) {
-                            tuple_util::for_each([block = info.block(i, j)](auto &&loop) { loop(block); }, loops);
+                        [&](auto i_tile, auto j_tile) {
+                            info.for_each_block(i_tile, j_tile, [&](int_t i, int_t j) {
+                                tuple_util::for_each([block = info.block(i, j)](auto &&loop) { loop(block); }, loops);
+                            });
                         },
-                        info.i_blocks(),
-                        info.j_blocks());
+                        info.i_tiles(),
+                        info.j_tiles());
                 }
             } // namespace loops_impl_
             using loops_impl_::make_loop;
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -85,16 +86,40 @@ namespace gridtools {
                 };
             }
 
+            /**
+             *  The domain is split into `IBlockSize` x `JBlockSize` blocks; all stages are executed block by block
+             *  using per thread temporaries of the block size. Blocks are grouped into `ITileSize` x `JTileSize` tiles,
+             *  each tile is processed by a single thread. By default the tile is a single block. Bigger tiles (sized
+             *  for L2 cache) make the neighbouring blocks reuse the halo data that is already in cache.
+             *
+             *  The epilogue (see `run_with_epilogue`) is applied to each block right after its last stage.
+             */
             template <class IBlockSize = integral_constant<int_t, 8>,
                 class JBlockSize = integral_constant<int_t, 8>,
-                class ThreadPool = thread_pool::omp>
-            struct cpu_kfirst {};
-
-            template <class IBlockSize, class JBlockSize, class ThreadPool, class Spec, class Grid, class DataStores>
-            void gridtools_backend_entry_point(cpu_kfirst<IBlockSize, JBlockSize, ThreadPool>,
+                class ThreadPool = thread_pool::omp,
+                class ITileSize = IBlockSize,
+                class JTileSize = JBlockSize>
+            struct cpu_kfirst {
+                static_assert(
+                    ITileSize::value % IBlockSize::value == 0, "tile size should be a multiple of block size");
+                static_assert(
+                    JTileSize::value % JBlockSize::value == 0, "tile size should be a multiple of block size");
+            };
+
+            template <class IBlockSize,
+                class JBlockSize,
+                class ThreadPool,
+                class ITileSize,
+                class JTileSize,
+                class Spec,
+                class Grid,
+                class DataStores,
+                class Epilogue>
+            void gridtools_backend_entry_point(cpu_kfirst<IBlockSize, JBlockSize, ThreadPool, ITileSize, JTileSize>,
                 Spec,
                 Grid const &grid,
-                DataStores external_data_stores) {
+                DataStores external_data_stores,
+                Epilogue const &epilogue) {
                 using stages_t = be_api::make_split_view<Spec>;
 
                 auto alloc = sid::cached_allocator(&std::make_unique<char[]>);
@@ -138,16 +163,46 @@ namespace gridtools {
                 int_t NBI = (total_i + IBlockSize::value - 1) / IBlockSize::value;
                 int_t NBJ = (total_j + JBlockSize::value - 1) / JBlockSize::value;
 
+                constexpr int_t i_tile_blocks = ITileSize::value / IBlockSize::value;
+                constexpr int_t j_tile_blocks = JTileSize::value / JBlockSize::value;
+
+                int_t NTI = (NBI + i_tile_blocks - 1) / i_tile_blocks;
+                int_t NTJ = (NBJ + j_tile_blocks - 1) / j_tile_blocks;
+
                 thread_pool::parallel_for_loop(
                     ThreadPool(),
-                    [&](auto bj, auto bi) {
-                        int_t i_size = bi + 1 == NBI ? total_i - bi * IBlockSize::value : IBlockSize::value;
-                        int_t j_size = bj + 1 == NBJ ? total_j - bj * JBlockSize::value : JBlockSize::value;
-                        tuple_util::for_each(
-                            [=](auto &&fun) GT_FORCE_INLINE_LAMBDA { fun(bi, bj, i_size, j_size); }, stage_loops);
+                    [&](auto tj, auto ti) {
+                        int_t bi_first = ti * i_tile_blocks;
+                        int_t bj_first = tj * j_tile_blocks;
+                        int_t bi_last = std::min(bi_first + i_tile_blocks, NBI);
+                        int_t bj_last = std::min(bj_first + j_tile_blocks, NBJ);
+                        for (int_t bi = bi_first; bi < bi_last; ++bi)
+                            for (int_t bj = bj_first; bj < bj_last; ++bj) {
+                                int_t i_size = bi + 1 == NBI ? total_i - bi * IBlockSize::value : IBlockSize::value;
+                                int_t j_size = bj + 1 == NBJ ? total_j - bj * JBlockSize::value : JBlockSize::value;
+                                tuple_util::for_each(
+                                    [=](auto &&fun) GT_FORCE_INLINE_LAMBDA { fun(bi, bj, i_size, j_size); },
+                                    stage_loops);
+                                epilogue(bi * IBlockSize::value, bj * JBlockSize::value, i_size, j_size);
+                            }
                     },
-                    NBJ,
-                    NBI);
+                    NTJ,
+                    NTI);
+            }
+
+            template <class IBlockSize,
+                class JBlockSize,
+                class ThreadPool,
+                class ITileSize,
+                class JTileSize,
+                class Spec,
+                class Grid,
+                class DataStores>
+            void gridtools_backend_entry_point(cpu_kfirst<IBlockSize, JBlockSize, ThreadPool, ITileSize, JTileSize> be,
+                Spec spec,
+                Grid const &grid,
+                DataStores external_data_stores) {
+                gridtools_backend_entry_point(be, spec, grid, std::move(external_data_stores), be_api::no_epilogue());
             }
         } // namespace cpu_kfirst_backend
         using cpu_kfirst_backend::cpu_kfirst;
@@ -18,6 +18,7 @@
 #include "../../common/hymap.hpp"
 #include "../../meta.hpp"
 #include "../../sid/concept.hpp"
+#include "../be_api.hpp"
 #include "../common/caches.hpp"
 #include "../common/dim.hpp"
 #include "../common/extent.hpp"
@@ -198,9 +199,13 @@ namespace gridtools {
                 using apply = core::check_valid_apply_overloads<Functor, Interval>;
             };
 
-            template <class Comp, class Backend, class Grid, class... Fields, size_t... Is>
-            auto run_impl(Comp comp, Backend &&be, Grid const &grid, std::index_sequence<Is...>, Fields &&...fields)
-                -> std::void_t<decltype(comp(arg<Is>()...))> {
+            template <class Comp, class Backend, class Grid, class Epilogue, class... Fields, size_t... Is>
+            auto run_impl(Comp comp,
+                Backend &&be,
+                Grid const &grid,
+                Epilogue const &epilogue,
+                std::index_sequence<Is...>,
+                Fields &&...fields) -> std::void_t<decltype(comp(arg<Is>()...))> {
                 using spec_t = decltype(comp(arg<Is>()...));
                 static_assert(
                     meta::is_instantiation_of<spec, spec_t>::value, "Invalid stencil composition specification.");
@@ -230,7 +235,8 @@ namespace gridtools {
                 using loop_t = int[sizeof...(Is)];
                 (void)loop_t{check_bounds(arg<Is>(), fields)...};
 #endif
-                core::call_entry_point_f<spec_t>()(std::forward<Backend>(be), grid, data_store_map_t{fields...});
+                core::call_entry_point_f<spec_t>()(
+                    std::forward<Backend>(be), grid, data_store_map_t{fields...}, epilogue);
             }
 
             template <class... Ts>
@@ -245,6 +251,26 @@ namespace gridtools {
                 run_impl(comp,
                     std::forward<Backend>(be),
                     grid,
+                    be_api::no_epilogue(),
+                    std::index_sequence_for<Fields...>(),
+                    std::forward<Fields>(fields)...);
+            }
+
+            /**
+             *  Runs the computation followed by the epilogue (for example the boundary conditions made by
+             *  `boundaries::boundary::epilogue`). The backends which execute the computation block by block apply the
+             *  epilogue to each block right after its last stage, while the block data is still in cache; the others
+             *  call it once after the computation.
+             */
+            template <class Comp, class Backend, class Grid, class Epilogue, class... Fields>
+            void run_with_epilogue(
+                Comp comp, Backend &&be, Grid const &grid, Epilogue const &epilogue, Fields &&...fields) {
+                static_assert(
+                    std::conjunction<is_sid<Fields>...>::value, "All computation fields must satisfy SID concept.");
+                run_impl(comp,
+                    std::forward<Backend>(be),
+                    grid,
+                    epilogue,
                     std::index_sequence_for<Fields...>(),
                     std::forward<Fields>(fields)...);
             }
@@ -286,6 +312,7 @@ namespace gridtools {
         using frontend_impl_::get_arg_intent;
         using frontend_impl_::multi_pass;
         using frontend_impl_::run;
+        using frontend_impl_::run_with_epilogue;
         using frontend_impl_::run_single_stage;
     } // namespace stencil
 } // namespace gridtools
@@ -15,6 +15,8 @@
 
 #include "../../layout_transformation.hpp"
 #include "../data_store.hpp"
+#include "../traits.hpp"
+#include "fortran_array_view.hpp"
 
 namespace gridtools {
     template <class DataStorePtr>
@@ -24,6 +26,7 @@ namespace gridtools {
         using lengths_t = std::decay_t<decltype(DataStorePtr()->lengths())>;
         using strides_t = std::decay_t<decltype(DataStorePtr()->strides())>;
         using data_ptr_t = decltype(DataStorePtr()->get_target_ptr());
+        using layout_t = typename data_store_t::layout_t;
 
         bindgen_fortran_array_descriptor const &m_descriptor;
 
@@ -70,6 +73,49 @@ namespace gridtools {
         using bindgen_view_element_type = std::remove_pointer_t<data_ptr_t>;
         using bindgen_is_acc_present = std::true_type;
 
+        /**
+         *  True if the stencils can run directly on the Fortran array instead of the data store: the data store is
+         *  host referenceable, has no masked dimensions and its unit stride dimension is the first one, like in
+         *  Fortran. The order of the other dimensions doesn't matter for the backends.
+         */
+        static constexpr bool is_zero_copy = storage::traits::is_host_referenceable<typename data_store_t::traits_t> &&
+                                             layout_t::masked_length == layout_t::unmasked_length &&
+                                             layout_t::at(0) == layout_t::max_arg;
+
+        /**
+         *  The Fortran array as a SID with the Fortran strides (no copy).
+         */
+        auto view() const {
+            return fortran_array_view<bindgen_view_element_type, bindgen_view_rank::value, fortran_array_adapter>(
+                m_descriptor);
+        }
+
+        /**
+         *  The SID to be passed to the stencil computation in place of the data store.
+         *
+         *  If `is_zero_copy`, this is the Fortran array itself and the data store is not touched. Otherwise the Fortran
+         *  data is transformed into the data store (unless `read` is false, i.e. the field is output only) and the
+         *  data store is returned; use `write_back` to transform the result back.
+         */
+        auto sid(DataStorePtr const &ds, bool read = true) const {
+            if constexpr (is_zero_copy) {
+                check_fortran_lengths(ds);
+                return view();
+            } else {
+                if (read)
+                    transform_to(ds);
+                return ds;
+            }
+        }
+
+        /**
+         *  Transforms the data store back into the Fortran array, if `sid` has returned the data store.
+         */
+        void write_back(DataStorePtr const &ds) const {
+            if constexpr (!is_zero_copy)
+                transform_from(ds);
+        }
+
         void transform_to(DataStorePtr const &dst) const {
             check_fortran_lengths(dst);
             transform_layout(
@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
@@ -20,6 +21,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 
@@ -77,72 +79,217 @@ namespace gridtools {
 
         template <class T, size_t Dim, class Kind, size_t UnitStrideDim>
         struct wrapper {
-            std::shared_ptr<pybind11::buffer_info> m_info;
+            // keeps the exported memory alive; the last owner releases it under the GIL
+            std::shared_ptr<void> m_owner;
+            T *m_ptr;
+            std::array<pybind11::ssize_t, Dim> m_shape;
+            std::array<pybind11::ssize_t, Dim> m_strides;
 
-            friend sid::simple_ptr_holder<T *> sid_get_origin(wrapper const &obj) {
-                return {reinterpret_cast<T *>(obj.m_info->ptr)};
-            }
+            friend sid::simple_ptr_holder<T *> sid_get_origin(wrapper const &obj) { return {obj.m_ptr}; }
             friend auto sid_get_strides(wrapper const &obj) {
-                std::array<pybind11::ssize_t, Dim> res;
-                assert(obj.m_info->strides.size() == Dim);
-                for (std::size_t i = 0; i != Dim; ++i) {
-                    assert(obj.m_info->strides[i] % obj.m_info->itemsize == 0);
-                    res[i] = obj.m_info->strides[i] / obj.m_info->itemsize;
-                }
-                return assign_unit_stride<UnitStrideDim>(std::move(res), sid_get_upper_bounds(obj));
+                return assign_unit_stride<UnitStrideDim>(obj.m_strides, obj.m_shape);
             }
-
             friend std::array<integral_constant<pybind11::ssize_t, 0>, Dim> sid_get_lower_bounds(wrapper const &) {
                 return {};
             }
-            friend std::array<pybind11::ssize_t, Dim> sid_get_upper_bounds(wrapper const &obj) {
-                std::array<pybind11::ssize_t, Dim> res;
-                assert(obj.m_info->shape.size() == Dim);
-                for (std::size_t i = 0; i != Dim; ++i) {
-                    assert(obj.m_info->shape[i] > 0);
-                    res[i] = obj.m_info->shape[i];
-                }
-                return res;
-            }
+            friend std::array<pybind11::ssize_t, Dim> sid_get_upper_bounds(wrapper const &obj) { return obj.m_shape; }
             friend meta::if_<std::is_same<Kind, sid::unknown_kind>, Kind, kind<Dim, Kind>> sid_get_strides_kind(
                 wrapper const &) {
                 return {};
             }
         };
 
-        template <class T, std::size_t Dim, class Kind = void, size_t UnitStrideDim = size_t(-1)>
-        wrapper<T, Dim, Kind, UnitStrideDim> as_sid(pybind11::buffer const &src) {
-            static_assert(std::is_trivially_copy_constructible_v<T>,
-                "as_sid should be instantiated with the trivially copyable type");
-            constexpr bool writable = !std::is_const<T>();
-            // pybind11::buffer::request accepts writable as an optional parameter (default is false).
-            // if writable is true PyBUF_WRITABLE flag is added while delegating to the PyObject_GetBuffer.
-            auto info = src.request(writable);
-            assert(!(writable && info.readonly));
-            if (info.ndim != Dim)
-                throw std::domain_error("buffer has incorrect number of dimensions: " + std::to_string(info.ndim) +
-                                        "; expected " + std::to_string(Dim));
-            if (info.itemsize != sizeof(T))
-                throw std::domain_error("buffer has incorrect itemsize: " + std::to_string(info.itemsize) +
-                                        "; expected " + std::to_string(sizeof(T)));
+        class buffer_holder {
+            Py_buffer m_view;
+
+          public:
+            buffer_holder(PyObject *obj, int flags) {
+                if (PyObject_GetBuffer(obj, &m_view, flags))
+                    throw pybind11::error_already_set();
+            }
+            buffer_holder(buffer_holder const &) = delete;
+            buffer_holder &operator=(buffer_holder const &) = delete;
+            ~buffer_holder() {
+                pybind11::gil_scoped_acquire gil;
+                PyBuffer_Release(&m_view);
+            }
+
+            Py_buffer const &view() const { return m_view; }
+        };
 
+        template <class T>
+        void check_format(char const *format) {
+            std::string actual = format ? format : "B";
             using format_desc_t = pybind11::format_descriptor<std::remove_const_t<T>>;
             auto expected_format = format_desc_t::format();
-            assert(info.format.size() == 1 && expected_format.size() == 1);
+            assert(actual.size() == 1 && expected_format.size() == 1);
             const char *int_formats = "bBhHiIlLqQnN";
-            const char *int_char = std::strchr(int_formats, info.format[0]);
+            const char *int_char = std::strchr(int_formats, actual[0]);
             const char *expected_int_char = std::strchr(int_formats, expected_format[0]);
             if (int_char && expected_int_char) {
                 // just check upper/lower case for integer formats which indicates signedness (itemsize already checked)
                 // direct format comparison in not enough, for details see
                 // https://github.com/pybind/pybind11/issues/1806 and https://github.com/pybind/pybind11/issues/1908
                 if (std::islower(*int_char) != std::islower(*expected_int_char))
-                    throw std::domain_error("incompatible integer formats: " + info.format + " and " + expected_format);
-            } else if (info.format != expected_format) {
-                throw std::domain_error(
-                    "buffer has incorrect format: " + info.format + "; expected " + expected_format);
+                    throw std::domain_error("incompatible integer formats: " + actual + " and " + expected_format);
+            } else if (actual != expected_format) {
+                throw std::domain_error("buffer has incorrect format: " + actual + "; expected " + expected_format);
+            }
+        }
+
+        template <class T, std::size_t Dim, class Kind = void, size_t UnitStrideDim = size_t(-1)>
+        wrapper<T, Dim, Kind, UnitStrideDim> as_sid(pybind11::buffer const &src) {
+            static_assert(std::is_trivially_copy_constructible_v<T>,
+                "as_sid should be instantiated with the trivially copyable type");
+            constexpr bool writable = !std::is_const<T>();
+            // The buffer is requested directly (not via `pybind11::buffer::request`) to avoid building
+            // `pybind11::buffer_info` with its vectors and strings on every call.
+            auto holder = std::make_shared<buffer_holder>(
+                src.ptr(), PyBUF_STRIDES | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0));
+            auto &&view = holder->view();
+            assert(!(writable && view.readonly));
+            if (view.ndim != Dim)
+                throw std::domain_error("buffer has incorrect number of dimensions: " + std::to_string(view.ndim) +
+                                        "; expected " + std::to_string(Dim));
+            if (view.itemsize != sizeof(T))
+                throw std::domain_error("buffer has incorrect itemsize: " + std::to_string(view.itemsize) +
+                                        "; expected " + std::to_string(sizeof(T)));
+
+            check_format<T>(view.format);
+
+            wrapper<T, Dim, Kind, UnitStrideDim> res = {nullptr, reinterpret_cast<T *>(view.buf)};
+            for (std::size_t i = 0; i != Dim; ++i) {
+                assert(view.shape[i] > 0);
+                assert(view.strides[i] % view.itemsize == 0);
+                res.m_shape[i] = view.shape[i];
+                res.m_strides[i] = view.strides[i] / view.itemsize;
+            }
+            res.m_owner = std::move(holder);
+            return res;
+        }
+
+        // The subset of the DLPack ABI (https://github.com/dmlc/dlpack) needed to import CPU tensors.
+        namespace dlpack {
+            enum dl_device_type : std::int32_t { cpu = 1, cuda_host = 3, cuda_managed = 13 };
+            enum dl_data_type_code : std::uint8_t { int_code = 0, uint_code = 1, float_code = 2 };
+
+            struct dl_device {
+                std::int32_t device_type;
+                std::int32_t device_id;
+            };
+
+            struct dl_data_type {
+                std::uint8_t code;
+                std::uint8_t bits;
+                std::uint16_t lanes;
+            };
+
+            struct dl_tensor {
+                void *data;
+                dl_device device;
+                std::int32_t ndim;
+                dl_data_type dtype;
+                std::int64_t *shape;
+                std::int64_t *strides;
+                std::uint64_t byte_offset;
+            };
+
+            struct dl_managed_tensor {
+                dl_tensor tensor;
+                void *manager_ctx;
+                void (*deleter)(dl_managed_tensor *);
+            };
+
+            template <class T>
+            bool is_compatible(dl_data_type const &dtype) {
+                if (dtype.lanes != 1 || dtype.bits != 8 * sizeof(T))
+                    return false;
+                if constexpr (std::is_floating_point_v<T>)
+                    return dtype.code == float_code;
+                else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+                    return dtype.code == (std::is_signed_v<T> ? int_code : uint_code);
+                // any other types are OK for us as soon as the sizeof is correct
+                return true;
+            }
+        } // namespace dlpack
+
+        /**
+         *  Makes a SID from an object that supports the DLPack protocol (`__dlpack__` method), f.e. numpy arrays.
+         *
+         *  Unlike `as_sid` it doesn't go through the buffer protocol: the tensor descriptor is read in place. The SID
+         *  takes the ownership of the tensor and calls its deleter when the last copy of the SID goes away.
+         *  Only the tensors in the host accessible memory are accepted.
+         */
+        template <class T, std::size_t Dim, class Kind = void, size_t UnitStrideDim = size_t(-1)>
+        wrapper<T, Dim, Kind, UnitStrideDim> as_dlpack_sid(pybind11::object const &src) {
+            static_assert(std::is_trivially_copy_constructible_v<T>,
+                "as_dlpack_sid should be instantiated with the trivially copyable type");
+            using namespace dlpack;
+
+            pybind11::object capsule = src.attr("__dlpack__")();
+            auto *managed = static_cast<dl_managed_tensor *>(PyCapsule_GetPointer(capsule.ptr(), "dltensor"));
+            if (!managed)
+                throw pybind11::error_already_set();
+            // By the protocol, the consumer renames the capsule and becomes responsible for calling the deleter.
+            if (PyCapsule_SetName(capsule.ptr(), "used_dltensor"))
+                throw pybind11::error_already_set();
+            std::shared_ptr<void> owner(managed, [](void *ptr) {
+                auto *tensor = static_cast<dl_managed_tensor *>(ptr);
+                if (tensor->deleter) {
+                    pybind11::gil_scoped_acquire gil;
+                    tensor->deleter(tensor);
+                }
+            });
+
+            auto const &tensor = managed->tensor;
+            switch (tensor.device.device_type) {
+            case cpu:
+            case cuda_host:
+            case cuda_managed:
+                break;
+            default:
+                throw std::domain_error("dlpack tensor is not in the host memory: device type " +
+                                        std::to_string(tensor.device.device_type));
             }
-            return {std::make_shared<pybind11::buffer_info>(std::move(info))};
+            if (tensor.ndim != Dim)
+                throw std::domain_error("dlpack tensor has incorrect number of dimensions: " +
+                                        std::to_string(tensor.ndim) + "; expected " + std::to_string(Dim));
+            if (!is_compatible<std::remove_const_t<T>>(tensor.dtype))
+                throw std::domain_error("dlpack tensor has incompatible data type: code " +
+                                        std::to_string(tensor.dtype.code) + ", " + std::to_string(tensor.dtype.bits) +
+                                        " bits, " + std::to_string(tensor.dtype.lanes) + " lanes");
+
+            wrapper<T, Dim, Kind, UnitStrideDim> res = {
+                nullptr, reinterpret_cast<T *>(static_cast<char *>(tensor.data) + tensor.byte_offset)};
+            pybind11::ssize_t stride = 1;
+            for (int i = Dim - 1; i >= 0; --i) {
+                assert(tensor.shape[i] > 0);
+                res.m_shape[i] = tensor.shape[i];
+                // no strides means the compact row-major layout
+                res.m_strides[i] = tensor.strides ? tensor.strides[i] : stride;
+                stride *= tensor.shape[i];
+            }
+            res.m_owner = std::move(owner);
+            return res;
+        }
+
+        /**
+         *  Calls `fun` with the GIL released.
+         *
+         *  The SIDs made by `as_sid` and `as_dlpack_sid` can be copied and destroyed without holding the GIL, so
+         *  the stencil computation on them could be wrapped into this to let other Python threads run meanwhile:
+         *  \code
+         *  m.def("copy", [](py::buffer from, py::buffer to) {
+         *      auto from_sid = as_sid<double const, 3>(from);
+         *      auto to_sid = as_sid<double, 3>(to);
+         *      without_gil([&] { copy(from_sid, to_sid); });
+         *  });
+         *  \endcode
+         */
+        template <class Fun>
+        decltype(auto) without_gil(Fun &&fun) {
+            pybind11::gil_scoped_release release;
+            return std::forward<Fun>(fun)();
         }
 
         struct typestr {
@@ -356,5 +503,8 @@ namespace gridtools {
     // Makes a SID from the `pybind11::buffer`.
     using python_sid_adapter_impl_::as_sid;
 
+    using python_sid_adapter_impl_::as_dlpack_sid;
+    using python_sid_adapter_impl_::without_gil;
+
     using python_sid_adapter_impl_::as_cuda_sid;
 } // namespace gridtools
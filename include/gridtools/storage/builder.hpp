@@ -9,9 +9,12 @@
  */
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <tuple>
 #include <type_traits>
 
+#include "../common/array.hpp"
 #include "../common/defs.hpp"
 #include "../common/for_each.hpp"
 #include "../common/hymap.hpp"
@@ -21,6 +24,7 @@
 #include "../common/tuple_util.hpp"
 #include "../meta.hpp"
 #include "../sid/unknown_kind.hpp"
+#include "bundle.hpp"
 #include "data_store.hpp"
 #include "traits.hpp"
 
@@ -47,39 +51,48 @@ namespace gridtools {
                 return obj;
             }
 
-            template <class Layout, class Info>
-            auto restore_indices(Info const &info, Layout, int src) {
-                auto l = info.lengths();
-                auto s = info.strides();
-                array<int, Info::ndims> res;
-                for (size_t i = 0; i < Info::ndims; ++i) {
-                    auto n = Layout::at(i);
-                    if (n == -1)
-                        res[i] = l[i] - 1;
-                    else if (n == 0)
-                        res[i] = src / s[i];
-                    else
-                        res[i] = src % s[Layout::find(n - 1)] / s[i];
-                }
-                return res;
-            }
-
+            /**
+             *  Writes `fun(indices...)` to every element of the storage.
+             *
+             *  The elements are visited in the memory order: all dimensions except the innermost one are flattened into
+             *  a single parallel loop over the rows, the innermost (unit stride) dimension is a `simd` loop.
+             *  The padding is never visited. The masked dimensions are not iterated, `fun` gets their last index.
+             */
             template <class Fun, class T, class Layout, class Info, size_t... Is>
-            void initializer_impl(Fun const &fun, T *dst, Layout layout, Info const &info, std::index_sequence<Is...>) {
-                int length = info.length();
-                auto in_range = [&](auto const &indices) {
-                    for (auto ok : {(tuple_util::get<Is>(indices) < tuple_util::get<Is>(info.native_lengths()))...})
-                        if (!ok)
-                            return false;
-                    return true;
-                };
+            void initializer_impl(Fun const &fun, T *dst, Layout, Info const &info, std::index_sequence<Is...>) {
+                constexpr int rank = Layout::unmasked_length;
+                array<int, Info::ndims> lengths = {(int)tuple_util::get<Is>(info.native_lengths())...};
+                array<int, Info::ndims> strides = {(int)tuple_util::get<Is>(info.native_strides())...};
+                for (int length : lengths)
+                    if (length == 0)
+                        return;
+                array<int, Info::ndims> first = {(Layout::at(Is) == -1 ? lengths[Is] - 1 : 0)...};
+                if constexpr (rank == 0) {
+                    *dst = fun(first[Is]...);
+                } else {
+                    constexpr int inner = Layout::find(rank - 1);
+                    assert(strides[inner] == 1);
+                    int inner_length = lengths[inner];
+                    int rows = 1;
+                    for (int n = 0; n < rank - 1; ++n)
+                        rows *= lengths[Layout::find(n)];
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-                for (int i = 0; i < length; ++i) {
-                    auto indices = restore_indices(info, layout, i);
-                    if (in_range(indices))
-                        dst[i] = fun(tuple_util::get<Is>(indices)...);
+                    for (int row = 0; row < rows; ++row) {
+                        auto indices = first;
+                        std::ptrdiff_t offset = 0;
+                        for (int n = rank - 2, rest = row; n >= 0; --n) {
+                            int dim = Layout::find(n);
+                            indices[dim] = rest % lengths[dim];
+                            rest /= lengths[dim];
+                            offset += (std::ptrdiff_t)indices[dim] * strides[dim];
+                        }
+                        T *ptr = dst + offset;
+#pragma omp simd
+                        for (int i = 0; i < inner_length; ++i)
+                            ptr[i] = fun((Is == inner ? i : indices[Is])...);
+                    }
                 }
             }
 
@@ -92,15 +105,37 @@ namespace gridtools {
             }
 
             template <class T>
-            auto wrap_value(T const &value) {
-                return [value = std::move(value)](auto *dst, auto, auto const &info) {
+            struct value_initializer {
+                T m_value;
+
+                template <class U, class Layout, class Info>
+                void operator()(U *dst, Layout, Info const &info) const {
                     int length = info.length();
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
                     for (int i = 0; i < length; ++i)
-                        dst[i] = value;
-                };
+                        dst[i] = m_value;
+                }
+
+                // an arithmetic zero (but not -0.) allows the data store to take zero filled memory from the
+                // allocator instead of writing it
+                friend bool storage_initializer_is_zero(value_initializer const &obj) {
+                    if constexpr (std::is_arithmetic_v<T>) {
+                        auto const *bytes = reinterpret_cast<unsigned char const *>(&obj.m_value);
+                        for (size_t i = 0; i != sizeof(T); ++i)
+                            if (bytes[i])
+                                return false;
+                        return true;
+                    } else {
+                        return false;
+                    }
+                }
+            };
+
+            template <class T>
+            value_initializer<T> wrap_value(T value) {
+                return {std::move(value)};
             }
 
             template <class Traits, class Layout>
@@ -315,6 +350,32 @@ namespace gridtools {
                 }
 
                 auto operator()() const { return build(); }
+
+                /**
+                 *  Builds a `bundle` of `N` interleaved fields with the given parameters (see `bundle.hpp`).
+                 *  The initializer (if any) takes the component index as an additional last argument.
+                 */
+                template <size_t N>
+                auto build_bundle() const {
+                    static_assert(N > 0, "bundle should have at least one component");
+                    static_assert(has<param::type>::value, "storage type is not set");
+                    static_assert(has<param::lengths>::value, "storage lengths are not set");
+                    using traits_t =
+                        meta::if_c<has<param::layout>::value, custom_traits<Traits, value_type<param::layout>>, Traits>;
+                    auto &&lengths = value<param::lengths>();
+                    auto &&name = value<param::name, std::string>();
+                    constexpr auto n = tuple_util::size<decltype(lengths)>::value;
+                    auto &&halos = value<param::halos, array<int, n>>();
+                    auto initializer = value<param::initializer, uninitialized>();
+                    using layout_t = typename interleaved_layout<traits::layout_type<traits_t, n>>::type;
+                    auto ds = make_data_store<custom_traits<traits_t, layout_t>,
+                        typename value_type<param::type>::type,
+                        value_type<param::id>>(name,
+                        tuple_util::deep_copy(tuple_util::push_back(lengths, integral_constant<int_t, N>())),
+                        tuple_util::deep_copy(tuple_util::push_back(halos, 0)),
+                        initializer);
+                    return bundle<decltype(ds), N>(std::move(ds));
+                }
             };
 #if GT_NVCC_WORKAROUND_1766
             // not sure if the same bug as https://github.com/GridTools/gridtools/issues/1766
@@ -0,0 +1,132 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../common/defs.hpp"
+#include "../common/hymap.hpp"
+#include "../common/integral_constant.hpp"
+#include "../common/layout_map.hpp"
+#include "../meta.hpp"
+#include "../sid/concept.hpp"
+#include "../sid/delegate.hpp"
+#include "../sid/sid_shift_origin.hpp"
+#include "../sid/unknown_kind.hpp"
+#include "data_store.hpp"
+#include "sid.hpp"
+
+/**
+ *  A bundle is a set of `N` fields of the same type and shape that share a single allocation.
+ *
+ *  The fields are interleaved: within every innermost (unit stride) row of the storage layout the rows of all fields
+ *  follow each other, i.e. for the `cpu_ifirst` layout the memory is ordered as `[k][j][field][i]`. Hence all
+ *  components at the same (j, k) lie within the same few pages and are read as a single stream, while each component
+ *  is still an ordinary SID with integer strides and unit stride along the innermost dimension.
+ *
+ *  Internally the bundle is a data store with an additional trailing dimension of length `N`, which is placed just
+ *  after the innermost dimension in the layout. The padding of the innermost dimension guarantees that every
+ *  component is aligned the same way as a standalone data store would be.
+ *
+ *  Usage:
+ *    auto fields = builder<cpu_ifirst>.type<double>().dimensions(nx, ny, nz).build_bundle<6>();
+ *    run_single_stage(f, backend, grid, fields.component(0), ..., fields.component(5), out);
+ *
+ *  If an initializer is given, it is called with the component index as an additional last argument.
+ */
+
+namespace gridtools {
+    namespace storage {
+        namespace bundle_impl_ {
+            template <class>
+            struct interleaved_layout;
+
+            // The innermost dimension stays innermost; the component dimension comes right after it.
+            template <int... Args>
+            struct interleaved_layout<layout_map<Args...>> {
+                static constexpr int max_arg = layout_map<Args...>::max_arg;
+                using type = layout_map<(Args == max_arg && Args != -1 ? Args + 1 : Args)...,
+                    (max_arg == -1 ? 0 : max_arg)>;
+            };
+
+            struct component_tag;
+
+            template <class Kind>
+            using component_kind =
+                meta::if_<std::is_same<Kind, sid::unknown_kind>, Kind, meta::list<component_tag, Kind>>;
+
+            template <class Dim, class Sid>
+            struct component_sid : sid::delegate<Sid> {
+                friend sid::ptr_holder_type<Sid> sid_get_origin(component_sid const &obj) {
+                    return sid::get_origin(obj.m_impl);
+                }
+                friend decltype(hymap::canonicalize_and_remove_key<Dim>(std::declval<sid::strides_type<Sid>>()))
+                sid_get_strides(component_sid const &obj) {
+                    return hymap::canonicalize_and_remove_key<Dim>(sid::get_strides(obj.m_impl));
+                }
+                friend decltype(hymap::canonicalize_and_remove_key<Dim>(std::declval<sid::lower_bounds_type<Sid>>()))
+                sid_get_lower_bounds(component_sid const &obj) {
+                    return hymap::canonicalize_and_remove_key<Dim>(sid::get_lower_bounds(obj.m_impl));
+                }
+                friend decltype(hymap::canonicalize_and_remove_key<Dim>(std::declval<sid::upper_bounds_type<Sid>>()))
+                sid_get_upper_bounds(component_sid const &obj) {
+                    return hymap::canonicalize_and_remove_key<Dim>(sid::get_upper_bounds(obj.m_impl));
+                }
+                // components have the strides of the underlying data store without the component dimension,
+                // hence they need their own strides kind
+                friend component_kind<sid::strides_kind<Sid>> sid_get_strides_kind(component_sid const &) {
+                    return {};
+                }
+
+                using sid::delegate<Sid>::delegate;
+            };
+
+            template <class DataStorePtr, size_t N>
+            class bundle {
+                static_assert(is_data_store_ptr<DataStorePtr>::value, GT_INTERNAL_ERROR);
+                using data_store_t = typename DataStorePtr::element_type;
+                using dim_t = integral_constant<int, data_store_t::ndims - 1>;
+
+                DataStorePtr m_ds;
+
+              public:
+                static constexpr size_t ndims = data_store_t::ndims - 1;
+                static constexpr size_t size = N;
+
+                bundle(DataStorePtr ds) : m_ds(std::move(ds)) {}
+
+                /**
+                 *  The underlying data store. It has the dimensions of the bundle plus the component dimension,
+                 *  i.e. `data_store()->host_view()(i, j, k, n)` accesses the n-th component.
+                 */
+                DataStorePtr const &data_store() const { return m_ds; }
+
+                auto const &name() const { return m_ds->name(); }
+
+                /**
+                 *  The n-th component of the bundle as a SID.
+                 *  The returned object shares the ownership of the allocation. Like for the data store, the target
+                 *  pointer is requested when the component is created.
+                 */
+                auto component(int_t n) const {
+                    assert(n >= 0 && n < (int_t)N);
+                    auto shifted = sid::shift_sid_origin(DataStorePtr(m_ds), hymap::keys<dim_t>::make_values(n));
+                    return component_sid<dim_t, decltype(shifted)>(std::move(shifted));
+                }
+            };
+        } // namespace bundle_impl_
+        using bundle_impl_::bundle;
+        using bundle_impl_::interleaved_layout;
+    } // namespace storage
+} // namespace gridtools
@@ -56,6 +56,12 @@ namespace gridtools {
                 return std::unique_ptr<T[], cpu_ifirst_impl_::deleter>(
                     static_cast<T *>(hugepage_alloc(size * sizeof(T))));
             }
+
+            template <class LazyType, class T = typename LazyType::type>
+            friend auto storage_allocate_zeroed(cpu_ifirst, LazyType, size_t size) {
+                return std::unique_ptr<T[], cpu_ifirst_impl_::deleter>(
+                    static_cast<T *>(hugepage_calloc(size * sizeof(T))));
+            }
         };
     } // namespace storage
 } // namespace gridtools
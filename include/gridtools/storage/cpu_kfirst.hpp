@@ -9,7 +9,9 @@
  */
 #pragma once
 
+#include <cstdlib>
 #include <memory>
+#include <new>
 #include <type_traits>
 
 #include "../common/integral_constant.hpp"
@@ -38,6 +40,20 @@ namespace gridtools {
             struct make_layout<N, std::index_sequence<Dim0, Dim1, Dim2, Dims...>> {
                 using type = layout_map<Dim0 + N - 3, Dim1 + N - 3, Dim2 + N - 3, (Dims - 3)...>;
             };
+
+            struct deleter {
+                template <class T>
+                void operator()(T *p) const {
+                    std::free(const_cast<std::remove_cv_t<T> *>(p));
+                }
+            };
+
+            template <class T>
+            std::unique_ptr<T[], deleter> make_unique_ptr(void *ptr, size_t size) {
+                if (!ptr && size)
+                    throw std::bad_alloc();
+                return std::unique_ptr<T[], deleter>(static_cast<T *>(ptr));
+            }
         } // namespace cpu_kfirst_impl_
 
         struct cpu_kfirst {
@@ -53,7 +69,13 @@ namespace gridtools {
 
             template <class LazyType, class T = typename LazyType::type>
             friend auto storage_allocate(cpu_kfirst, LazyType, size_t size) {
-                return std::make_unique<T[]>(size);
+                return cpu_kfirst_impl_::make_unique_ptr<T>(std::malloc(size * sizeof(T)), size);
+            }
+
+            // `calloc` skips zeroing for large blocks that come from `mmap`
+            template <class LazyType, class T = typename LazyType::type>
+            friend auto storage_allocate_zeroed(cpu_kfirst, LazyType, size_t size) {
+                return cpu_kfirst_impl_::make_unique_ptr<T>(std::calloc(size, sizeof(T)), size);
             }
         };
     } // namespace storage
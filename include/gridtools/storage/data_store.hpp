@@ -30,6 +30,37 @@ namespace gridtools {
         struct uninitialized {};
 
         namespace data_store_impl_ {
+            /**
+             *  Initializers can tell that they fill the storage with zero bytes by providing
+             *  `bool storage_initializer_is_zero(Initializer const&)` ADL function.
+             *  In that case the initialization is skipped if the traits can allocate zero filled memory.
+             */
+            template <class Initializer>
+            auto is_zero_initializer(Initializer const &obj, int) -> decltype(storage_initializer_is_zero(obj)) {
+                return storage_initializer_is_zero(obj);
+            }
+
+            template <class Initializer>
+            bool is_zero_initializer(Initializer const &, ...) {
+                return false;
+            }
+
+            template <class Traits, class T, class Initializer>
+            bool use_zeroed_allocation(Initializer const &initializer) {
+                if constexpr (traits::can_allocate_zeroed<Traits, std::remove_const_t<T>>)
+                    return is_zero_initializer(initializer, 0);
+                else
+                    return false;
+            }
+
+            template <class Traits, class T>
+            auto allocate(size_t size, bool zeroed) {
+                if constexpr (traits::can_allocate_zeroed<Traits, T>)
+                    if (zeroed)
+                        return traits::allocate_zeroed<Traits, T>(size);
+                return traits::allocate<Traits, T>(size);
+            }
+
             template <class Traits, class T, class Info, class Kind>
             class base {
                 static constexpr size_t byte_alignment = traits::byte_alignment<Traits>;
@@ -46,6 +77,7 @@ namespace gridtools {
                 mutable_data_t *m_target_ptr;
 
               public:
+                using traits_t = Traits;
                 using layout_t = traits::layout_type<Traits, Info::ndims>;
                 using data_t = T;
                 using kind_t = Kind;
@@ -61,9 +93,9 @@ namespace gridtools {
 
               protected:
                 template <class Halos>
-                base(std::string name, Info info, Halos const &halos)
+                base(std::string name, Info info, Halos const &halos, bool zeroed = false)
                     : m_name(std::move(name)), m_info(std::move(info)),
-                      m_target_ptr_holder(traits::allocate<Traits, mutable_data_t>(m_info.length() + alignment_t())) {
+                      m_target_ptr_holder(allocate<Traits, mutable_data_t>(m_info.length() + alignment_t(), zeroed)) {
                     auto offset_to_align = m_info.index_from_tuple(halos);
                     auto byte_offset = offset_to_align * sizeof(T);
                     auto address_to_align = reinterpret_cast<std::uintptr_t>(m_target_ptr_holder.get()) + byte_offset;
@@ -155,8 +187,10 @@ namespace gridtools {
 
                 template <class Initializer, class Halos>
                 data_store(std::string name, Info info, Halos const &halos, Initializer const &initializer)
-                    : data_store::base(std::move(name), std::move(info), halos) {
-                    initializer(this->raw_target_ptr(), typename data_store::layout_t(), this->info());
+                    : data_store::base(
+                          std::move(name), std::move(info), halos, use_zeroed_allocation<Traits, T>(initializer)) {
+                    if (!use_zeroed_allocation<Traits, T>(initializer))
+                        initializer(this->raw_target_ptr(), typename data_store::layout_t(), this->info());
                 }
 
                 T *get_target_ptr() const { return this->raw_target_ptr(); }
@@ -189,7 +223,13 @@ namespace gridtools {
 
                 template <class Initializer, std::enable_if_t<is_host_refrenceable<Initializer>::value, int> = 0>
                 void init(Initializer const &initializer) {
-                    initializer(this->raw_target_ptr(), typename data_store::layout_t(), this->info());
+                    if (!use_zeroed_allocation<Traits, T>(initializer))
+                        initializer(this->raw_target_ptr(), typename data_store::layout_t(), this->info());
+                }
+
+                template <class Initializer>
+                static bool zeroed(Initializer const &initializer) {
+                    return IsHostRefrenceable && use_zeroed_allocation<Traits, T>(initializer);
                 }
 
               public:
@@ -198,7 +238,7 @@ namespace gridtools {
 
                 template <class Initializer, class Halos>
                 data_store(std::string name, Info info, Halos const &halos, Initializer const &initializer)
-                    : base<Traits, T const, Info, Kind>(std::move(name), std::move(info), halos) {
+                    : base<Traits, T const, Info, Kind>(std::move(name), std::move(info), halos, zeroed(initializer)) {
                     init(initializer);
                 }
                 T const *get_target_ptr() const { return this->raw_target_ptr(); }
@@ -87,6 +87,23 @@ namespace gridtools {
             template <class Traits, class T>
             using target_ptr_type = decltype(allocate<Traits, T>(0));
 
+            template <class Traits, class T, class = void>
+            struct has_allocate_zeroed : std::false_type {};
+
+            template <class Traits, class T>
+            struct has_allocate_zeroed<Traits,
+                T,
+                std::void_t<decltype(storage_allocate_zeroed(
+                    std::declval<Traits>(), meta::lazy::id<T>(), std::declval<size_t>()))>> : std::true_type {};
+
+            template <class Traits, class T>
+            constexpr bool can_allocate_zeroed = has_allocate_zeroed<Traits, T>::value;
+
+            template <class Traits, class T>
+            auto allocate_zeroed(size_t size) {
+                return storage_allocate_zeroed(Traits(), meta::lazy::id<T>(), size);
+            }
+
             template <class Traits, class T>
             std::enable_if_t<!is_host_referenceable<Traits>> update_target(T *dst, T const *src, size_t size) {
                 storage_update_target(Traits(), dst, src, size);
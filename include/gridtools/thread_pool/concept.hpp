@@ -25,9 +25,21 @@
  *     thread_pool_parallel_for_loop(pool, func, lim0, lim1, lim2);
  *     etc.
  *   They are optional and could be provided for performance reasons.
+ *
+ *   The pool may also provide
+ *     thread_pool_async(pool, func, deps...);
+ *   which launches `func()` asynchronously once all `deps`, the completion handles returned by the earlier calls,
+ *   have completed, and returns a copyable completion handle with the `wait()`, `wait_for()` and `get()` members,
+ *   where `get()` rethrows the exception thrown by `func`, if any. If it is not provided, `thread_pool::async` is
+ *   synchronous: it waits for `deps`, executes `func` on the calling thread and returns a ready
+ *   `std::shared_future<void>`.
  */
 
+#include <exception>
+#include <future>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "../common/stride_util.hpp"
 #include "../common/tuple_util.hpp"
@@ -63,8 +75,33 @@ namespace gridtools {
                 -> decltype(thread_pool_parallel_for_loop(obj, f, limits...)) {
                 return thread_pool_parallel_for_loop(obj, f, limits...);
             }
+
+            template <class T, class F, class... Deps>
+            auto async_impl(T const &obj, F &&f, int, Deps const &...deps)
+                -> decltype(thread_pool_async(obj, std::forward<F>(f), deps...)) {
+                return thread_pool_async(obj, std::forward<F>(f), deps...);
+            }
+
+            template <class T, class F, class... Deps>
+            std::shared_future<void> async_impl(T const &, F &&f, long, Deps const &...deps) {
+                std::promise<void> done;
+                try {
+                    (..., deps.wait());
+                    std::forward<F>(f)();
+                    done.set_value();
+                } catch (...) {
+                    done.set_exception(std::current_exception());
+                }
+                return done.get_future().share();
+            }
+
+            template <class T, class F, class... Deps>
+            auto async(T const &obj, F &&f, Deps const &...deps) {
+                return async_impl(obj, std::forward<F>(f), 0, deps...);
+            }
         } // namespace concept_impl_
 
+        using concept_impl_::async;
         using concept_impl_::get_max_threads;
         using concept_impl_::get_thread_num;
         using concept_impl_::parallel_for_loop;
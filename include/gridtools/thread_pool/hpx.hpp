@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <utility>
+
+#include <hpx/include/async.hpp>
 #include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/runtime.hpp>
 
@@ -24,6 +27,15 @@ namespace gridtools {
             friend void thread_pool_parallel_for_loop(hpx, F const &f, I lim) {
                 ::hpx::parallel::for_loop(::hpx::parallel::execution::par, 0, lim, f);
             }
+
+            // waiting for `deps` suspends only the HPX task, not the worker thread
+            template <class F, class... Deps>
+            friend auto thread_pool_async(hpx, F &&f, Deps const &...deps) {
+                return ::hpx::async([f = std::forward<F>(f), deps...]() mutable {
+                    (..., deps.wait());
+                    std::move(f)();
+                }).share();
+            }
         };
     } // namespace thread_pool
 } // namespace gridtools
@@ -13,11 +13,140 @@
 #include "../common/integral_constant.hpp"
 
 #if defined(_OPENMP) || defined(GT_HIP_OPENMP_WORKAROUND)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include <omp.h>
 #endif
 
 namespace gridtools {
     namespace thread_pool {
+#if defined(_OPENMP) || defined(GT_HIP_OPENMP_WORKAROUND)
+        namespace omp_impl_ {
+            /**
+             *  The worker threads that run the asynchronous tasks of the `omp` pool.
+             *
+             *  A task is started only once its dependencies have completed, so the workers never block on them; among
+             *  the ready tasks the earliest submitted runs first. At most `size` tasks run concurrently. The parallel
+             *  regions opened by a task share the OpenMP threads with the other running tasks (see `region_threads`):
+             *  a task running alone gets all of them, concurrent tasks split them evenly. A region keeps its share
+             *  until it ends, so a task starting while another one is inside a region may oversubscribe the machine
+             *  for that long.
+             */
+            class async_workers {
+                struct pending {
+                    std::function<bool()> ready;
+                    std::packaged_task<void()> task;
+                };
+
+                std::mutex m_mutex;
+                std::condition_variable m_done;
+                std::deque<pending> m_tasks;
+                bool m_stop = false;
+                std::atomic<int> m_running = 0;
+                int m_max_threads;
+                std::vector<std::thread> m_threads;
+
+                static inline thread_local bool t_on_worker = false;
+
+                // counts the task as running until it returns, before its completion is published
+                struct running_scope {
+                    std::atomic<int> &m_running;
+                    running_scope(std::atomic<int> &running) : m_running(running) { ++m_running; }
+                    ~running_scope() { --m_running; }
+                };
+
+                void work() {
+                    t_on_worker = true;
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    while (true) {
+                        auto found = std::find_if(
+                            m_tasks.begin(), m_tasks.end(), [](pending const &item) { return item.ready(); });
+                        if (found != m_tasks.end()) {
+                            auto task = std::move(found->task);
+                            m_tasks.erase(found);
+                            lock.unlock();
+                            task();
+                            lock.lock();
+                            m_done.notify_all();
+                        } else if (m_tasks.empty()) {
+                            if (m_stop)
+                                return;
+                            m_done.wait(lock);
+                        } else {
+                            // the dependencies were not submitted here, nothing notifies about their completion
+                            m_done.wait_for(lock, std::chrono::milliseconds(1));
+                        }
+                    }
+                }
+
+                async_workers() : m_max_threads(omp_get_max_threads()) {
+                    for (int i = 0; i != size; ++i)
+                        m_threads.emplace_back([this] { work(); });
+                }
+
+              public:
+                static constexpr int size = 2;
+
+                async_workers(async_workers const &) = delete;
+                async_workers &operator=(async_workers const &) = delete;
+
+                ~async_workers() {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_stop = true;
+                    }
+                    m_done.notify_all();
+                    for (auto &thread : m_threads)
+                        thread.join();
+                }
+
+                template <class F, class... Deps>
+                std::shared_future<void> submit(F &&f, Deps const &...deps) {
+                    std::packaged_task<void()> task([this, f = std::forward<F>(f)]() mutable {
+                        running_scope scope(m_running);
+                        std::move(f)();
+                    });
+                    auto res = task.get_future().share();
+                    auto ready = [deps...] {
+                        return (... && (deps.wait_for(std::chrono::seconds(0)) == std::future_status::ready));
+                    };
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_tasks.push_back({std::move(ready), std::move(task)});
+                    }
+                    m_done.notify_all();
+                    return res;
+                }
+
+                static bool on_worker() { return t_on_worker; }
+                int running() const { return m_running; }
+                int max_threads() const { return m_max_threads; }
+
+                static async_workers &get() {
+                    static async_workers res;
+                    return res;
+                }
+            };
+
+            // the number of threads for a parallel region opened by the calling thread
+            inline int region_threads() {
+                if (!async_workers::on_worker())
+                    return omp_get_max_threads();
+                auto &workers = async_workers::get();
+                return std::max(1, workers.max_threads() / std::max(1, workers.running()));
+            }
+        } // namespace omp_impl_
+#endif
 
         struct omp {
 #if defined(_OPENMP) || defined(GT_HIP_OPENMP_WORKAROUND)
@@ -26,14 +155,14 @@ namespace gridtools {
 
             template <class F, class I, class I_t = to_integral_type_t<I>>
             friend void thread_pool_parallel_for_loop(omp, F const &f, I lim) {
-#pragma omp parallel for
+#pragma omp parallel for num_threads(omp_impl_::region_threads())
                 for (I_t i = 0; i < lim; ++i)
                     f(i);
             }
 
             template <class F, class I, class J, class I_t = to_integral_type_t<I>, class J_t = to_integral_type_t<J>>
             friend void thread_pool_parallel_for_loop(omp, F const &f, I i_lim, J j_lim) {
-#pragma omp parallel for collapse(2)
+#pragma omp parallel for collapse(2) num_threads(omp_impl_::region_threads())
                 for (J_t j = 0; j < j_lim; ++j)
                     for (I_t i = 0; i < i_lim; ++i)
                         f(i, j);
@@ -47,12 +176,18 @@ namespace gridtools {
                 class J_t = to_integral_type_t<J>,
                 class K_t = to_integral_type_t<K>>
             friend void thread_pool_parallel_for_loop(omp, F const &f, I i_lim, J j_lim, K k_lim) {
-#pragma omp parallel for collapse(3)
+#pragma omp parallel for collapse(3) num_threads(omp_impl_::region_threads())
                 for (K_t k = 0; k < k_lim; ++k)
                     for (J_t j = 0; j < j_lim; ++j)
                         for (I_t i = 0; i < i_lim; ++i)
                             f(i, j, k);
             }
+
+            // see `omp_impl_::async_workers`
+            template <class F, class... Deps>
+            friend std::shared_future<void> thread_pool_async(omp, F &&f, Deps const &...deps) {
+                return omp_impl_::async_workers::get().submit(std::forward<F>(f), deps...);
+            }
 #endif
         };
     } // namespace thread_pool
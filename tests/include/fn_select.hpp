@@ -28,6 +28,20 @@
 namespace {
     using fn_backend_t = gridtools::fn::backend::naive;
 }
+#elif defined(GT_FN_NAIVE_LANES)
+#ifndef GT_STENCIL_CPU_IFIRST
+#define GT_STENCIL_CPU_IFIRST
+#endif
+#ifndef GT_STORAGE_CPU_IFIRST
+#define GT_STORAGE_CPU_IFIRST
+#endif
+#ifndef GT_TIMER_OMP
+#define GT_TIMER_OMP
+#endif
+#include <gridtools/fn/backend/naive.hpp>
+namespace {
+    using fn_backend_t = gridtools::fn::backend::naive_column_lanes<GT_FN_NAIVE_LANES>;
+}
 #elif defined(GT_FN_GPU)
 #ifndef GT_STENCIL_GPU
 #define GT_STENCIL_GPU
@@ -57,15 +71,18 @@ namespace {
 
 namespace gridtools::fn::backend {
     namespace naive_impl_ {
-        template <class ThreadPool>
+        template <class ThreadPool, int ColumnLanes>
         struct naive_with_threadpool;
-        template <class ThreadPool>
-        storage::cpu_kfirst backend_storage_traits(naive_with_threadpool<ThreadPool>);
-        template <class ThreadPool>
-        timer_dummy backend_timer_impl(naive_with_threadpool<ThreadPool>);
-        template <class ThreadPool>
-        inline char const *backend_name(naive_with_threadpool<ThreadPool> const &) {
-            return "naive";
+        // the columns processed in lock-step are adjacent in memory with the i-first layout
+        template <class ThreadPool, int ColumnLanes>
+        std::conditional_t<ColumnLanes == 1, storage::cpu_kfirst, storage::cpu_ifirst> backend_storage_traits(
+            naive_with_threadpool<ThreadPool, ColumnLanes>);
+        template <class ThreadPool, int ColumnLanes>
+        std::conditional_t<ColumnLanes == 1, timer_dummy, timer_omp> backend_timer_impl(
+            naive_with_threadpool<ThreadPool, ColumnLanes>);
+        template <class ThreadPool, int ColumnLanes>
+        inline char const *backend_name(naive_with_threadpool<ThreadPool, ColumnLanes> const &) {
+            return ColumnLanes == 1 ? "naive" : "naive_lanes";
         }
     } // namespace naive_impl_
 
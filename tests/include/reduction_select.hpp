@@ -42,6 +42,20 @@ namespace {
 namespace {
     using reduction_backend_t = gridtools::reduction::cpu;
 }
+#elif defined(GT_REDUCTION_CPU_REPRODUCIBLE)
+#ifndef GT_STENCIL_CPU_IFIRST
+#define GT_STENCIL_CPU_IFIRST
+#endif
+#ifndef GT_STORAGE_CPU_IFIRST
+#define GT_STORAGE_CPU_IFIRST
+#endif
+#ifndef GT_TIMER_OMP
+#define GT_TIMER_OMP
+#endif
+#include <gridtools/reduction/cpu_reproducible.hpp>
+namespace {
+    using reduction_backend_t = gridtools::reduction::cpu_reproducible;
+}
 #elif defined(GT_REDUCTION_GPU)
 #ifndef GT_STENCIL_GPU
 #define GT_STENCIL_GPU
@@ -74,6 +88,11 @@ namespace gridtools {
         timer_omp backend_timer_impl(cpu);
         inline char const *backend_name(cpu const &) { return "cpu"; }
 
+        struct cpu_reproducible;
+        storage::cpu_ifirst backend_storage_traits(cpu_reproducible);
+        timer_omp backend_timer_impl(cpu_reproducible);
+        inline char const *backend_name(cpu_reproducible const &) { return "cpu_reproducible"; }
+
         namespace gpu_backend {
             struct gpu;
             storage::gpu backend_storage_traits(gpu);
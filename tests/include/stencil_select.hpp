@@ -135,53 +135,53 @@ namespace gridtools {
         inline char const *backend_name(naive const &) { return "naive"; }
 
         namespace cpu_kfirst_backend {
-            template <class, class, class>
+            template <class, class, class, class, class>
             struct cpu_kfirst;
 
-            template <class I, class J, class T>
-            storage::cpu_kfirst backend_storage_traits(cpu_kfirst<I, J, T>);
+            template <class I, class J, class T, class TI, class TJ>
+            storage::cpu_kfirst backend_storage_traits(cpu_kfirst<I, J, T, TI, TJ>);
 
-            template <class I, class J, class T>
-            timer_omp backend_timer_impl(cpu_kfirst<I, J, T>);
+            template <class I, class J, class T, class TI, class TJ>
+            timer_omp backend_timer_impl(cpu_kfirst<I, J, T, TI, TJ>);
 
-            template <class I, class J, class T>
-            char const *backend_name(cpu_kfirst<I, J, T> const &) {
+            template <class I, class J, class T, class TI, class TJ>
+            char const *backend_name(cpu_kfirst<I, J, T, TI, TJ> const &) {
                 return "cpu_kfirst";
             }
 
 #if defined(GT_STENCIL_CPU_KFIRST_HPX)
-            template <class I, class J>
-            char const *backend_name(cpu_kfirst<I, J, thread_pool::hpx> const &) {
+            template <class I, class J, class TI, class TJ>
+            char const *backend_name(cpu_kfirst<I, J, thread_pool::hpx, TI, TJ> const &) {
                 return "cpu_kfirst_hpx";
             }
 
-            template <class I, class J>
-            void backend_init(cpu_kfirst<I, J, thread_pool::hpx>, int &argc, char **argv) {
+            template <class I, class J, class TI, class TJ>
+            void backend_init(cpu_kfirst<I, J, thread_pool::hpx, TI, TJ>, int &argc, char **argv) {
                 hpx_start(argc, argv);
             }
 
-            template <class I, class J>
-            void backend_finalize(cpu_kfirst<I, J, thread_pool::hpx>) {
+            template <class I, class J, class TI, class TJ>
+            void backend_finalize(cpu_kfirst<I, J, thread_pool::hpx, TI, TJ>) {
                 hpx_stop();
             }
 #endif
         } // namespace cpu_kfirst_backend
 
         namespace cpu_ifirst_backend {
-            template <class>
+            template <class, class, class>
             struct cpu_ifirst;
 
-            template <class T>
-            storage::cpu_ifirst backend_storage_traits(cpu_ifirst<T>);
+            template <class T, class I, class J>
+            storage::cpu_ifirst backend_storage_traits(cpu_ifirst<T, I, J>);
 
-            template <class T>
-            std::false_type backend_supports_icosahedral(cpu_ifirst<T>);
+            template <class T, class I, class J>
+            std::false_type backend_supports_icosahedral(cpu_ifirst<T, I, J>);
 
-            template <class T>
-            timer_omp backend_timer_impl(cpu_ifirst<T>);
+            template <class T, class I, class J>
+            timer_omp backend_timer_impl(cpu_ifirst<T, I, J>);
 
-            template <class T>
-            char const *backend_name(cpu_ifirst<T> const &) {
+            template <class T, class I, class J>
+            char const *backend_name(cpu_ifirst<T, I, J> const &) {
                 return "cpu_ifirst";
             }
 
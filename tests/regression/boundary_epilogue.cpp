@@ -0,0 +1,120 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gtest/gtest.h>
+
+#include <gridtools/boundaries/boundary.hpp>
+#include <gridtools/boundaries/copy.hpp>
+#include <gridtools/boundaries/value.hpp>
+#include <gridtools/stencil/cartesian.hpp>
+
+#include <stencil_select.hpp>
+#include <test_environment.hpp>
+
+namespace {
+    using namespace gridtools;
+    using namespace stencil;
+    using namespace cartesian;
+    using namespace boundaries;
+
+#if defined(GT_STENCIL_GPU) || defined(GT_STENCIL_GPU_HORIZONTAL)
+    using bc_arch_t = gcl::gpu;
+#else
+    using bc_arch_t = gcl::cpu;
+#endif
+
+    struct scale {
+        using out = inout_accessor<0>;
+        using in = in_accessor<1>;
+
+        using param_list = make_param_list<out, in>;
+
+        template <class Eval>
+        GT_FUNCTION static void apply(Eval &&eval) {
+            eval(out()) = 2 * eval(in());
+        }
+    };
+
+    constexpr int halo = 2;
+
+    auto in = [](int i, int j, int k) { return i + 2 * j + 3 * k; };
+
+    template <class Env>
+    array<halo_descriptor, 3> make_halos(int k_halo = 0) {
+        return {halo_descriptor(halo, halo, halo, Env::d(0) - halo - 1, Env::d(0)),
+            halo_descriptor(halo, halo, halo, Env::d(1) - halo - 1, Env::d(1)),
+            halo_descriptor(k_halo, k_halo, k_halo, Env::k_size() - k_halo - 1, Env::k_size())};
+    }
+
+    template <class Env>
+    bool is_halo(int i, int j) {
+        return i < halo || i >= Env::d(0) - halo || j < halo || j >= Env::d(1) - halo;
+    }
+
+    GT_REGRESSION_TEST(boundary_epilogue_value, test_environment<halo>, stencil_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        auto out = TypeParam::make_storage(-1);
+        auto bc = make_boundary<bc_arch_t>(make_halos<TypeParam>(), value_boundary<float_t>(42));
+        auto comp = [&, grid = TypeParam::make_grid(), in = TypeParam::make_const_storage(in)] {
+            run_with_epilogue(
+                [](auto out, auto in) { return execute_parallel().stage(scale(), out, in); },
+                stencil_backend_t(),
+                grid,
+                bc.epilogue(out),
+                out,
+                in);
+        };
+        comp();
+        auto view = out->const_host_view();
+        for (int i = 0; i < TypeParam::d(0); ++i)
+            for (int j = 0; j < TypeParam::d(1); ++j)
+                for (int k = 0; k < TypeParam::k_size(); ++k)
+                    ASSERT_EQ(view(i, j, k), is_halo<TypeParam>(i, j) ? 42 : 2 * in(i, j, k));
+        TypeParam::benchmark("boundary_epilogue_value", comp);
+    }
+
+    // the k halo is overwritten by the boundary condition after the stencil computed it
+    GT_REGRESSION_TEST(boundary_epilogue_k_halo, test_environment<halo>, stencil_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        constexpr int k_halo = 1;
+        auto out = TypeParam::make_storage(-1);
+        auto bc = make_boundary<bc_arch_t>(make_halos<TypeParam>(k_halo), value_boundary<float_t>(42));
+        run_with_epilogue([](auto out, auto in) { return execute_parallel().stage(scale(), out, in); },
+            stencil_backend_t(),
+            TypeParam::make_grid(),
+            bc.epilogue(out),
+            out,
+            TypeParam::make_const_storage(in));
+        auto view = out->const_host_view();
+        for (int i = 0; i < TypeParam::d(0); ++i)
+            for (int j = 0; j < TypeParam::d(1); ++j)
+                for (int k = 0; k < TypeParam::k_size(); ++k) {
+                    bool k_boundary = k < k_halo || k >= TypeParam::k_size() - k_halo;
+                    ASSERT_EQ(view(i, j, k), is_halo<TypeParam>(i, j) || k_boundary ? 42 : 2 * in(i, j, k));
+                }
+    }
+
+    GT_REGRESSION_TEST(boundary_epilogue_copy, test_environment<halo>, stencil_backend_t) {
+        auto out = TypeParam::make_storage(-1);
+        auto src = TypeParam::make_storage([](int i, int j, int k) { return -i - j - k; });
+        auto bc = make_boundary<bc_arch_t>(make_halos<TypeParam>(), copy_boundary());
+        run_with_epilogue([](auto out, auto in) { return execute_parallel().stage(scale(), out, in); },
+            stencil_backend_t(),
+            TypeParam::make_grid(),
+            bc.epilogue(out, src),
+            out,
+            TypeParam::make_const_storage(in));
+        auto view = out->const_host_view();
+        for (int i = 0; i < TypeParam::d(0); ++i)
+            for (int j = 0; j < TypeParam::d(1); ++j)
+                for (int k = 0; k < TypeParam::k_size(); ++k)
+                    ASSERT_EQ(view(i, j, k), is_halo<TypeParam>(i, j) ? -i - j - k : 2 * in(i, j, k));
+    }
+} // namespace
@@ -24,6 +24,8 @@ namespace {
     using namespace literals;
 
     struct laplacian {
+        using extents_t = extents<extent<dim::i, -1, 1>, extent<dim::j, -1, 1>>;
+
         GT_FUNCTION constexpr auto operator()() const {
             return [](auto const &in) {
                 constexpr auto i = cartesian::dim::i();
@@ -36,6 +38,8 @@ namespace {
 
     template <class D>
     struct flux {
+        using extents_t = extents<extent<D, 0, 1>>;
+
         GT_FUNCTION constexpr auto operator()() const {
             return [](auto const &in, auto const &lap) {
                 auto tmp = deref(shift(lap, D(), 1)) - deref(lap);
@@ -45,6 +49,8 @@ namespace {
     };
 
     struct hdiff {
+        using extents_t = extents<extent<dim::i, -1, 0>, extent<dim::j, -1, 0>>;
+
         GT_FUNCTION constexpr auto operator()() const {
             return [](auto const &in, auto const &coeff, auto const &flx, auto const &fly) {
                 constexpr auto i = cartesian::dim::i();
@@ -135,6 +141,37 @@ namespace {
         TypeParam::benchmark("fn_cartesian_horizontal_diffusion", comp);
     }
 
+    GT_REGRESSION_TEST(fn_cartesian_horizontal_diffusion_block_tmp, test_environment<2>, fn_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        horizontal_diffusion_repository repo(TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
+        auto out = TypeParam::make_storage();
+        auto fencil = [&](int i, int j, int k, auto &out, auto const &in, auto const &coeff) {
+            using sizes_t = hymap::keys<dim::i, dim::j, dim::k>::values<int, int, int>;
+            auto domain = cartesian_domain(sizes_t{i - 4, j - 4, k}, sizes_t{2, 2, 0});
+            auto backend = make_backend(fn_backend_t(), domain);
+
+            backend.stencil_executor()()
+                .arg(out)
+                .arg(in)
+                .arg(coeff)
+                .template block_tmp<float_t>()
+                .template block_tmp<float_t>()
+                .template block_tmp<float_t>()
+                .assign(3_c, laplacian(), 1_c)
+                .assign(4_c, flux<dim::i>(), 1_c, 3_c)
+                .assign(5_c, flux<dim::j>(), 1_c, 3_c)
+                .assign(0_c, hdiff(), 1_c, 2_c, 4_c, 5_c)
+                .execute();
+        };
+        auto comp =
+            [&, coeff = TypeParam::make_const_storage(repo.coeff), in = TypeParam::make_const_storage(repo.in)] {
+                fencil(TypeParam::d(0), TypeParam::d(1), TypeParam::d(2), out, in, coeff);
+            };
+        comp();
+        TypeParam::verify(repo.out, out);
+        TypeParam::benchmark("fn_cartesian_horizontal_diffusion_block_tmp", comp);
+    }
+
     GT_REGRESSION_TEST(fn_cartesian_horizontal_diffusion_fused, test_environment<2>, fn_backend_t) {
         horizontal_diffusion_repository repo(TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
         auto out = TypeParam::make_storage();
@@ -27,6 +27,9 @@ namespace {
     using stencil::global_parameter;
 
     struct u_forward_scan : fwd {
+        // u_stage is read at k - 1 (body, epilogue) and k + 1 (prologue)
+        using vertical_windows = meta::list<vertical_window<2, -1, 1>>;
+
         static GT_FUNCTION constexpr auto prologue() {
             return nvcc_workarounds::make_1_tuple(scan_pass(
                 [](auto /*acc*/,
@@ -0,0 +1,143 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <gridtools/fn/csr_neighbor_table.hpp>
+#include <gridtools/fn/sid_neighbor_table.hpp>
+#include <gridtools/fn/soa_neighbor_table.hpp>
+#include <gridtools/fn/unstructured.hpp>
+
+#include <fn_select.hpp>
+#include <test_environment.hpp>
+
+namespace {
+    using namespace gridtools;
+    using namespace fn;
+    using namespace literals;
+
+    // sums an edge field over the vertex to edge neighbors, one shift per neighbor
+    struct gather_stencil {
+        constexpr auto operator()() const {
+            return [](auto const &in) {
+                std::decay_t<decltype(deref(in))> res = 0;
+                tuple_util::host_device::for_each(
+                    [&](auto i) {
+                        auto shifted = shift(in, v2e(), i);
+                        if (can_deref(shifted))
+                            res += deref(shifted);
+                    },
+                    meta::rename<tuple, meta::make_indices_c<6>>());
+                return res;
+            };
+        }
+    };
+
+    constexpr inline auto in = [](int edge, int k) { return (edge + 3 * k) % 23; };
+
+    // the layouts are built from the neighbor table of the test mesh which is held in a data store
+    template <class Env>
+    struct gather_test {
+        using float_t = typename Env::float_t;
+        using mesh_t = decltype(Env::fn_unstructured_mesh());
+        static constexpr int max_v2e = mesh_t::max_v2e_neighbors_t::value;
+
+        mesh_t mesh = Env::fn_unstructured_mesh();
+        decltype(mesh.v2e_table()) v2e_ds = mesh.v2e_table();
+        decltype(sid_neighbor_table::as_neighbor_table<integral_constant<int, 0>, integral_constant<int, 1>, max_v2e>(
+            v2e_ds)) v2e_table = sid_neighbor_table::as_neighbor_table<integral_constant<int, 0>,
+            integral_constant<int, 1>,
+            max_v2e>(v2e_ds);
+
+        // copies host data to a data store, so that it is accessible on the target
+        template <class T>
+        static auto to_target(std::vector<T> const &src) {
+            return storage::builder<typename Env::storage_traits_t>
+                .dimensions(src.size())
+                .template type<T>()
+                .initializer([&](int i) { return src[i]; })
+                .unknown_id()
+                .build();
+        }
+
+        template <class Table>
+        void run(std::string const &name, Table const &table) {
+            auto input = mesh.make_const_storage(in, mesh.nedges(), mesh.nlevels());
+            auto out = mesh.make_storage(mesh.nvertices(), mesh.nlevels());
+            auto domain = unstructured_domain({mesh.nvertices(), mesh.nlevels()}, {}, connectivity<v2e>(table));
+            auto backend = make_backend(fn_backend_t(), domain);
+            auto comp = [&] {
+                backend.stencil_executor()().arg(out).arg(input).assign(0_c, gather_stencil(), 1_c).execute();
+            };
+            comp();
+            auto v2e_view = v2e_ds->const_host_view();
+            Env::verify(
+                [&](int vertex, int k) {
+                    float_t res = 0;
+                    for (int n = 0; n != max_v2e; ++n)
+                        if (int edge = v2e_view(vertex, n); edge != -1)
+                            res += in(edge, k);
+                    return res;
+                },
+                out);
+            Env::benchmark(name, comp);
+        }
+
+        template <class T>
+        void run_soa(std::string const &name) {
+            auto data = to_target(soa_neighbor_table::make_data<T>(v2e_table, mesh.nvertices()));
+            run(name, soa_neighbor_table::as_neighbor_table<max_v2e>(data->get_const_target_ptr(), mesh.nvertices()));
+        }
+
+        template <class T>
+        void run_csr(std::string const &name) {
+            auto data = csr_neighbor_table::make_data<T>(v2e_table, mesh.nvertices());
+            auto offsets = to_target(data.offsets);
+            auto targets = to_target(data.targets);
+            run(name,
+                csr_neighbor_table::as_neighbor_table<max_v2e>(
+                    offsets->get_const_target_ptr(), targets->get_const_target_ptr()));
+        }
+    };
+
+    GT_REGRESSION_TEST(fn_neighbor_gather_sid, test_environment<>, fn_backend_t) {
+        gather_test<TypeParam> test;
+        test.run("fn_neighbor_gather_sid", test.v2e_table);
+    }
+
+    GT_REGRESSION_TEST(fn_neighbor_gather_soa, test_environment<>, fn_backend_t) {
+        gather_test<TypeParam>().template run_soa<int>("fn_neighbor_gather_soa");
+    }
+
+    GT_REGRESSION_TEST(fn_neighbor_gather_soa_int16, test_environment<>, fn_backend_t) {
+        try {
+            gather_test<TypeParam>().template run_soa<std::int16_t>("fn_neighbor_gather_soa_int16");
+        } catch (std::out_of_range const &) {
+            GTEST_SKIP() << "the mesh is too large for 16 bit indices";
+        }
+    }
+
+    GT_REGRESSION_TEST(fn_neighbor_gather_csr, test_environment<>, fn_backend_t) {
+        gather_test<TypeParam>().template run_csr<int>("fn_neighbor_gather_csr");
+    }
+
+    GT_REGRESSION_TEST(fn_neighbor_gather_csr_int16, test_environment<>, fn_backend_t) {
+        try {
+            gather_test<TypeParam>().template run_csr<std::int16_t>("fn_neighbor_gather_csr_int16");
+        } catch (std::out_of_range const &) {
+            GTEST_SKIP() << "the mesh is too large for 16 bit indices";
+        }
+    }
+} // namespace
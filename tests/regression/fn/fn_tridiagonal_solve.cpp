@@ -13,6 +13,10 @@
 #include <gridtools/fn/cartesian.hpp>
 #include <gridtools/fn/unstructured.hpp>
 
+#if defined(GT_FN_NAIVE) || defined(GT_FN_NAIVE_LANES)
+#include <gridtools/fn/tridiagonal.hpp>
+#endif
+
 #include <fn_select.hpp>
 #include <nvcc_workarounds.hpp>
 #include <test_environment.hpp>
@@ -115,7 +119,31 @@ namespace {
         };
         comp();
         TypeParam::verify(expected, x);
+        TypeParam::benchmark("fn_cartesian_tridiagonal_solve", comp);
+    }
+
+#if defined(GT_FN_NAIVE) || defined(GT_FN_NAIVE_LANES)
+    template <class TypeParam>
+    void test_tridiagonal_building_block(tridiagonal_algorithm algorithm, int segments = 0) {
+        auto x = TypeParam::make_storage();
+        fn::tridiagonal_solve<cartesian::dim::k>(fn_backend_t(),
+            TypeParam::fn_cartesian_sizes(),
+            TypeParam::make_const_storage(a),
+            TypeParam::make_const_storage(b),
+            TypeParam::make_const_storage(c),
+            TypeParam::make_const_storage(d(TypeParam::d(2))),
+            x,
+            algorithm,
+            segments);
+        TypeParam::verify(expected, x);
+    }
+
+    GT_REGRESSION_TEST(fn_cartesian_tridiagonal_building_block, vertical_test_environment<>, fn_backend_t) {
+        test_tridiagonal_building_block<TypeParam>(tridiagonal_algorithm::automatic);
+        test_tridiagonal_building_block<TypeParam>(tridiagonal_algorithm::thomas);
+        test_tridiagonal_building_block<TypeParam>(tridiagonal_algorithm::partitioned, 3);
     }
+#endif
 
     GT_REGRESSION_TEST(fn_unstructured_tridiagonal_solve, vertical_test_environment<>, fn_backend_t) {
         using float_t = typename TypeParam::float_t;
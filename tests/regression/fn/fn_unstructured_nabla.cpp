@@ -8,8 +8,15 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include <gridtools/fn/mesh_reordering.hpp>
 #include <gridtools/fn/sid_neighbor_table.hpp>
 #include <gridtools/fn/unstructured.hpp>
 #include <gridtools/sid/dimension_to_tuple_like.hpp>
@@ -25,15 +32,8 @@ namespace {
     struct zavg_stencil {
         constexpr auto operator()() const {
             return [](auto const &pp, auto const &s) {
-                std::decay_t<decltype(deref(pp))> tmp = 0;
-                tuple_util::host_device::for_each(
-                    [&](auto i) {
-                        auto shifted_pp = shift(pp, e2v(), i);
-                        if (can_deref(shifted_pp))
-                            tmp += deref(shifted_pp);
-                    },
-                    meta::rename<tuple, meta::make_indices_c<2>>());
-                tmp /= 2;
+                using float_t = std::decay_t<decltype(deref(pp))>;
+                auto tmp = reduce_neighbors(e2v(), std::plus<>(), float_t(0), pp) / 2;
                 auto ss = deref(s);
                 return make_tuple(tmp * tuple_get(0_c, ss), tmp * tuple_get(1_c, ss));
             };
@@ -44,17 +44,16 @@ namespace {
         constexpr auto operator()() const {
             return [](auto const &zavg, auto const &sign, auto const &vol) {
                 using float_t = std::decay_t<decltype(deref(vol))>;
-                auto signs = deref(sign);
-                tuple<float_t, float_t> tmp(0, 0);
-                tuple_util::host_device::for_each(
-                    [&](auto i) {
-                        auto shifted_zavg = shift(zavg, v2e(), i);
-                        if (can_deref(shifted_zavg)) {
-                            tuple_get(0_c, tmp) += tuple_get(0_c, deref(shifted_zavg)) * get<i.value>(signs);
-                            tuple_get(1_c, tmp) += tuple_get(1_c, deref(shifted_zavg)) * get<i.value>(signs);
-                        }
+                using vec_t = tuple<float_t, float_t>;
+                auto tmp = reduce_neighbors(
+                    v2e(),
+                    [](vec_t const &acc, auto sign, auto const &zavg) {
+                        return vec_t(tuple_get(0_c, acc) + tuple_get(0_c, zavg) * sign,
+                            tuple_get(1_c, acc) + tuple_get(1_c, zavg) * sign);
                     },
-                    meta::rename<tuple, meta::make_indices_c<6>>());
+                    vec_t(0, 0),
+                    neighbor_weights(deref(sign)),
+                    zavg);
                 auto v = deref(vol);
                 return make_tuple(tuple_get(0_c, tmp) / v, tuple_get(1_c, tmp) / v);
             };
@@ -291,6 +290,98 @@ namespace {
         TypeParam::benchmark("fn_unstructured_nabla_fused_tuple_of_fields", comp);
     }
 
+    // Runs nabla on the mesh with randomly numbered locations (as it could come from a file), optionally reordered
+    // by RCM for locality. The fields are initialized in the numbering of the renumbered mesh.
+    template <class Env>
+    void run_renumbered(std::string const &name, bool reorder) {
+        using float_t = typename Env::float_t;
+        using storage_traits_t = typename Env::storage_traits_t;
+        using namespace mesh_reordering;
+        using mesh_t = decltype(Env::fn_unstructured_mesh());
+        constexpr int max_v2e = mesh_t::max_v2e_neighbors_t::value;
+        constexpr int max_e2v = mesh_t::max_e2v_neighbors_t::value;
+
+        auto mesh = Env::fn_unstructured_mesh();
+        int nvertices = mesh.nvertices();
+        int nedges = mesh.nedges();
+        int nlevels = mesh.nlevels();
+
+        auto to_host_table = [](auto const &ds, auto n) {
+            auto view = ds->const_host_view();
+            std::vector<array<int, decltype(n)::value>> res(ds->lengths()[0]);
+            for (size_t i = 0; i != res.size(); ++i)
+                for (int j = 0; j != decltype(n)::value; ++j)
+                    res[i][j] = view(i, j);
+            return res;
+        };
+        auto v2e_orig = to_host_table(mesh.v2e_table(), integral_constant<int, max_v2e>());
+        auto e2v_orig = to_host_table(mesh.e2v_table(), integral_constant<int, max_e2v>());
+
+        auto shuffled = [](int n, unsigned seed) {
+            std::vector<int> res(n);
+            std::iota(res.begin(), res.end(), 0);
+            std::shuffle(res.begin(), res.end(), std::mt19937(seed));
+            return permutation(std::move(res));
+        };
+        auto v_perm = shuffled(nvertices, 1);
+        auto e_perm = shuffled(nedges, 2);
+        if (reorder) {
+            auto v2e = renumber(v2e_orig.data(), v_perm, e_perm);
+            auto e2v = renumber(e2v_orig.data(), e_perm, v_perm);
+            auto v_rcm = reverse_cuthill_mckee(nvertices, v2e.data(), e2v.data());
+            auto e_rcm = induced_permutation(nedges, e2v.data(), v_rcm);
+            v_perm = compose(v_perm, v_rcm);
+            e_perm = compose(e_perm, e_rcm);
+        }
+        auto make_table = [](auto const &table) {
+            using list_t = typename std::decay_t<decltype(table)>::value_type;
+            constexpr int n = tuple_util::size<list_t>::value;
+            auto ds = storage::builder<storage_traits_t>
+                          .dimensions(table.size(), integral_constant<int, n>())
+                          .template type<int>()
+                          .initializer([&](int i, int j) { return table[i][j]; })
+                          .unknown_id()
+                          .build();
+            return ds;
+        };
+        auto v2e_table = make_table(renumber(v2e_orig.data(), v_perm, e_perm));
+        auto e2v_table = make_table(renumber(e2v_orig.data(), e_perm, v_perm));
+        auto v2e_ptr = sid_neighbor_table::as_neighbor_table<integral_constant<int, 0>,
+            integral_constant<int, 1>,
+            max_v2e>(v2e_table);
+        auto e2v_ptr = sid_neighbor_table::as_neighbor_table<integral_constant<int, 0>,
+            integral_constant<int, 1>,
+            max_e2v>(e2v_table);
+
+        auto v_old = [&](auto const &fun) {
+            return [&fun, &v_perm](int v, auto... k) { return fun(v_perm.new_to_old(v), k...); };
+        };
+        auto e_old = [&](auto const &fun) {
+            return [&fun, &e_perm](int e, int k) { return fun(e_perm.new_to_old(e), k); };
+        };
+        auto pp = mesh.make_const_storage(v_old(::pp), nvertices, nlevels);
+        auto sign = mesh.template make_const_storage<array<float_t, 6>>(v_old(::sign), nvertices);
+        auto vol = mesh.make_const_storage(v_old(::vol), nvertices);
+        auto s = mesh.template make_const_storage<tuple<float_t, float_t>>(e_old(::s), nedges, nlevels);
+        auto nabla = mesh.template make_storage<tuple<float_t, float_t>>(nvertices, nlevels);
+
+        auto comp = [&] {
+            fencil(fn_backend_t(), nvertices, nedges, nlevels, v2e_ptr, e2v_ptr, nabla, pp, s, sign, vol);
+        };
+        comp();
+        auto expected = make_expected(mesh);
+        Env::verify([&](int v, int k) { return expected(v_perm.new_to_old(v), k); }, nabla);
+        Env::benchmark(name, comp);
+    }
+
+    GT_REGRESSION_TEST(fn_unstructured_nabla_shuffled, test_environment<>, fn_backend_t) {
+        run_renumbered<TypeParam>("fn_unstructured_nabla_shuffled", false);
+    }
+
+    GT_REGRESSION_TEST(fn_unstructured_nabla_reordered, test_environment<>, fn_backend_t) {
+        run_renumbered<TypeParam>("fn_unstructured_nabla_reordered", true);
+    }
+
     GT_REGRESSION_TEST(fn_unstructured_nabla_field_of_dimension_to_tuple_like, test_environment<>, fn_backend_t) {
         using float_t = typename TypeParam::float_t;
 
@@ -122,6 +122,28 @@ namespace {
         };
     }
 
+    // two level decomposition: small blocks for the temporaries, grouped in bigger per thread tiles
+    template <class Backend>
+    struct tiled {
+        using type = Backend;
+    };
+
+#if defined(GT_STENCIL_CPU_KFIRST)
+    template <class I, class J, class ThreadPool>
+    struct tiled<cpu_kfirst<I, J, ThreadPool, I, J>> {
+        using type = cpu_kfirst<I,
+            J,
+            ThreadPool,
+            integral_constant<int_t, 4 * I::value>,
+            integral_constant<int_t, 2 * J::value>>;
+    };
+#elif defined(GT_STENCIL_CPU_IFIRST)
+    template <class ThreadPool>
+    struct tiled<cpu_ifirst<ThreadPool, integral_constant<int_t, 0>, integral_constant<int_t, 0>>> {
+        using type = cpu_ifirst<ThreadPool, integral_constant<int_t, 64>, integral_constant<int_t, 4>>;
+    };
+#endif
+
     GT_REGRESSION_TEST(horizontal_diffusion, test_environment<2>, stencil_backend_t) {
         horizontal_diffusion_repository repo(TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
         auto out = TypeParam::make_storage();
@@ -133,4 +155,21 @@ namespace {
         TypeParam::verify(repo.out, out);
         TypeParam::benchmark("horizontal_diffusion", comp);
     }
+
+    GT_REGRESSION_TEST(horizontal_diffusion_tiled, test_environment<2>, stencil_backend_t) {
+        using backend_t = typename tiled<stencil_backend_t>::type;
+        if constexpr (std::is_same_v<backend_t, stencil_backend_t>) {
+            GTEST_SKIP() << "no tiling for this backend";
+        } else {
+            horizontal_diffusion_repository repo(TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
+            auto out = TypeParam::make_storage();
+            auto comp = [grid = TypeParam::make_grid(),
+                            coeff = TypeParam::make_const_storage(repo.coeff),
+                            in = TypeParam::make_const_storage(repo.in),
+                            &out] { run(get_spec<TypeParam>(), backend_t(), grid, in, coeff, out); };
+            comp();
+            TypeParam::verify(repo.out, out);
+            TypeParam::benchmark("horizontal_diffusion_tiled", comp);
+        }
+    }
 } // namespace
@@ -0,0 +1,88 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gtest/gtest.h>
+
+#include <gridtools/stencil/cartesian.hpp>
+#include <gridtools/storage/bundle.hpp>
+
+#include <stencil_select.hpp>
+#include <test_environment.hpp>
+
+namespace {
+    using namespace gridtools;
+    using namespace stencil;
+    using namespace cartesian;
+
+    // A point-wise kernel that reads many fields at the same (i, j, k), as typical physics parameterizations do.
+    struct weighted_sum_functor {
+        using in0 = in_accessor<0>;
+        using in1 = in_accessor<1>;
+        using in2 = in_accessor<2>;
+        using in3 = in_accessor<3>;
+        using in4 = in_accessor<4>;
+        using in5 = in_accessor<5>;
+        using out = inout_accessor<6>;
+
+        using param_list = make_param_list<in0, in1, in2, in3, in4, in5, out>;
+
+        template <class Eval>
+        GT_FUNCTION static void apply(Eval &&eval) {
+            eval(out()) = eval(in0()) + 2 * eval(in1()) + 3 * eval(in2()) + 4 * eval(in3()) + 5 * eval(in4()) +
+                          6 * eval(in5());
+        }
+    };
+
+    auto in = [](int n) { return [n](int i, int j, int k) { return i + j + k + n; }; };
+    auto expected = [](int i, int j, int k) {
+        int res = 0;
+        for (int n = 0; n < 6; ++n)
+            res += (n + 1) * in(n)(i, j, k);
+        return res;
+    };
+
+    GT_REGRESSION_TEST(interleaved_fields_separate, test_environment<>, stencil_backend_t) {
+        auto out = TypeParam::make_storage();
+        auto comp = [&out,
+                        grid = TypeParam::make_grid(),
+                        in0 = TypeParam::make_const_storage(in(0)),
+                        in1 = TypeParam::make_const_storage(in(1)),
+                        in2 = TypeParam::make_const_storage(in(2)),
+                        in3 = TypeParam::make_const_storage(in(3)),
+                        in4 = TypeParam::make_const_storage(in(4)),
+                        in5 = TypeParam::make_const_storage(in(5))] {
+            run_single_stage(weighted_sum_functor(), stencil_backend_t(), grid, in0, in1, in2, in3, in4, in5, out);
+        };
+        comp();
+        TypeParam::verify(expected, out);
+        TypeParam::benchmark("interleaved_fields_separate", comp);
+    }
+
+    GT_REGRESSION_TEST(interleaved_fields_bundle, test_environment<>, stencil_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        auto out = TypeParam::make_storage();
+        auto fields = TypeParam::template builder<float_t const>()
+                          .initializer([](int i, int j, int k, int n) { return in(n)(i, j, k); })
+                          .template build_bundle<6>();
+        auto comp = [&out,
+                        grid = TypeParam::make_grid(),
+                        in0 = fields.component(0),
+                        in1 = fields.component(1),
+                        in2 = fields.component(2),
+                        in3 = fields.component(3),
+                        in4 = fields.component(4),
+                        in5 = fields.component(5)] {
+            run_single_stage(weighted_sum_functor(), stencil_backend_t(), grid, in0, in1, in2, in3, in4, in5, out);
+        };
+        comp();
+        TypeParam::verify(expected, out);
+        TypeParam::benchmark("interleaved_fields_bundle", comp);
+    }
+} // namespace
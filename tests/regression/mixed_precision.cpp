@@ -0,0 +1,82 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <gridtools/sid/convert.hpp>
+#include <gridtools/stencil/cartesian.hpp>
+
+#include <stencil_select.hpp>
+#include <test_environment.hpp>
+
+namespace {
+    using namespace gridtools;
+    using namespace stencil;
+    using namespace cartesian;
+
+    // First order upwind advection of a tracer with a positive velocity field.
+    struct upwind_advection {
+        using out = inout_accessor<0>;
+        using tracer = in_accessor<1, extent<-1, 0, -1, 0>>;
+        using u = in_accessor<2>;
+        using v = in_accessor<3>;
+
+        using param_list = make_param_list<out, tracer, u, v>;
+
+        template <class Eval>
+        GT_FUNCTION static void apply(Eval &&eval) {
+            double q = eval(tracer());
+            eval(out()) = q - eval(u()) * (q - eval(tracer(-1, 0, 0))) - eval(v()) * (q - eval(tracer(0, -1, 0)));
+        }
+    };
+
+    auto tracer = [](int i, int j, int k) { return std::sin(.1 * i) * std::cos(.2 * j) + .01 * k; };
+    auto u = [](int i, int j, int k) { return .3 + .001 * j; };
+    auto v = [](int i, int j, int k) { return .2 + .001 * i; };
+    auto expected = [](int i, int j, int k) {
+        double q = tracer(i, j, k);
+        return q - u(i, j, k) * (q - tracer(i - 1, j, k)) - v(i, j, k) * (q - tracer(i, j - 1, k));
+    };
+
+    // all fields are stored and computed in double
+    GT_REGRESSION_TEST(mixed_precision_double, test_environment<1>, stencil_backend_t) {
+        auto out = TypeParam::template make_storage<double>();
+        auto comp = [&out,
+                        grid = TypeParam::make_grid(),
+                        q = TypeParam::template make_const_storage<double>(tracer),
+                        u = TypeParam::template make_const_storage<double>(::u),
+                        v = TypeParam::template make_const_storage<double>(::v)] {
+            run_single_stage(upwind_advection(), stencil_backend_t(), grid, out, q, u, v);
+        };
+        comp();
+        TypeParam::verify(expected, out);
+        TypeParam::benchmark("mixed_precision_double", comp);
+    }
+
+    // all fields are stored in float and computed in double
+    GT_REGRESSION_TEST(mixed_precision_float_storage, test_environment<1>, stencil_backend_t) {
+        auto out = TypeParam::template make_storage<float>();
+        auto q = TypeParam::template make_const_storage<float>(tracer);
+        auto u = TypeParam::template make_const_storage<float>(::u);
+        auto v = TypeParam::template make_const_storage<float>(::v);
+        auto comp = [grid = TypeParam::make_grid(),
+                        out = sid::convert<double>(out),
+                        q = sid::convert<double>(q),
+                        u = sid::convert<double>(u),
+                        v = sid::convert<double>(v)] {
+            run_single_stage(upwind_advection(), stencil_backend_t(), grid, out, q, u, v);
+        };
+        comp();
+        TypeParam::verify(expected, out);
+        TypeParam::benchmark("mixed_precision_float_storage", comp);
+    }
+} // namespace
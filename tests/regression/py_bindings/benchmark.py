@@ -0,0 +1,27 @@
+# Measures the per call overhead of passing arrays from Python to the exported functions.
+# It is not a test; run it from the build directory: python benchmark.py [calls]
+import os
+import sys
+import timeit
+
+sys.path.append(os.getcwd())
+
+import numpy as np
+import py_implementation as testee
+
+n = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+
+src = np.zeros((4, 4, 4), dtype=np.double)
+dst = np.zeros_like(src)
+
+
+def report(name, stmt):
+    seconds = min(timeit.repeat(stmt, number=n, repeat=3))
+    print(f"{name:32} {seconds / n * 1e6:8.3f} us/call")
+
+
+report("as_sid", lambda: testee.as_sid_3D(src, dst))
+if hasattr(np.ndarray, "__dlpack__"):
+    report("as_dlpack_sid", lambda: testee.as_dlpack_sid_3D(src, dst))
+report("copy 4x4x4", lambda: testee.copy_from_3D(src, dst))
+report("copy 4x4x4, GIL released", lambda: testee.copy_from_3D_without_gil(src, dst))
@@ -20,6 +20,32 @@ def test_3d_with_unit_stride():
     testee.copy_from_3D_with_unit_stride(src, dst)
     assert np.all(dst == src)
 
+def test_3d_dlpack():
+    src = np.fromfunction(lambda i, j, k : i + j + k, (3, 4, 5), dtype=np.double)
+    dst = np.zeros_like(src)
+    testee.copy_from_3D_dlpack(src, dst)
+    assert np.all(dst == src)
+    # non-contiguous view
+    dst = np.zeros((5, 4, 3), dtype=np.double).transpose()
+    testee.copy_from_3D_dlpack(src, dst)
+    assert np.all(dst == src)
+
+def test_3d_without_gil():
+    src = np.fromfunction(lambda i, j, k : i + j + k, (3, 4, 5), dtype=np.double)
+    dst = np.zeros_like(src)
+    testee.copy_from_3D_without_gil(src, dst)
+    assert np.all(dst == src)
+
+def test_incorrect_format():
+    src = np.fromfunction(lambda i, j, k : i + j + k, (3, 4, 5), dtype=np.double)
+    dst = np.zeros_like(src)
+    # the same shape and strides, but different format
+    try:
+        testee.copy_from_3D(src.view(np.int64), dst)
+        assert False
+    except ValueError:
+        pass
+
 def test_1d():
     shape = (3, 4, 5)
     src = np.arange(shape[0], dtype=np.double)
@@ -65,6 +91,10 @@ def test_cuda_sid():
 
 test_3d()
 test_3d_with_unit_stride()
+if hasattr(np.ndarray, "__dlpack__"):
+    test_3d_dlpack()
+test_3d_without_gil()
+test_incorrect_format()
 test_1d()
 test_scalar()
 test_cuda_sid()
@@ -101,6 +101,20 @@ PYBIND11_MODULE(py_implementation, m) {
         },
         "Copy from one 3D buffer of doubles to another, requires `from.strides[2] == to.strides[2] == "
         "sizeof(double)`.");
+    m.def(
+        "copy_from_3D_dlpack",
+        [](py::object from, py::object to) {
+            copy(as_dlpack_sid<double const, 3>(from), as_dlpack_sid<double, 3>(to));
+        },
+        "Copy from one 3D array of doubles to another, the arrays are passed via DLPack.");
+    m.def(
+        "copy_from_3D_without_gil",
+        [](py::buffer from, py::buffer to) {
+            auto from_sid = as_sid<double const, 3>(from);
+            auto to_sid = as_sid<double, 3>(to);
+            without_gil([&] { copy(from_sid, to_sid); });
+        },
+        "Copy from one 3D buffer of doubles to another, the GIL is released during the copy.");
     m.def(
         "copy_from_1D",
         [](py::buffer from, py::buffer to) { copy(as_sid<double const, 1>(from), as_sid<double, 3>(to)); },
@@ -115,4 +129,14 @@ PYBIND11_MODULE(py_implementation, m) {
             check_cuda_sid(as_cuda_sid<double const, 3>(testeee), ptr, strides, dims);
         },
         "Check CUDA Sid.");
+
+    // The functions below only adapt their arguments; they are used to measure the per call overhead.
+    m.def("as_sid_3D", [](py::buffer from, py::buffer to) {
+        as_sid<double const, 3>(from);
+        as_sid<double, 3>(to);
+    });
+    m.def("as_dlpack_sid_3D", [](py::object from, py::object to) {
+        as_dlpack_sid<double const, 3>(from);
+        as_dlpack_sid<double, 3>(to);
+    });
 }
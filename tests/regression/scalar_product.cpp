@@ -10,7 +10,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <limits>
 
 #include <gridtools/reduction.hpp>
 #include <gridtools/stencil/cartesian.hpp>
@@ -72,4 +75,130 @@ namespace {
         EXPECT_NEAR(comp(), TypeParam::d(0) * TypeParam::d(1) * TypeParam::d(2), default_precision<float_t>());
     }
 
+    struct fill_negative_functor {
+        using out = inout_accessor<0>;
+        using param_list = make_param_list<out>;
+
+        template <class Eval>
+        GT_FUNCTION static void apply(Eval &&eval) {
+            eval(out()) = -1;
+        }
+    };
+
+    GT_REGRESSION_TEST(reuse, test_environment<>, reduction_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        auto out = reduction::make_reducible<reduction_backend_t, storage_traits_t>(
+            float_t(0), TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
+        auto grid = TypeParam::make_grid();
+        float_t size = TypeParam::d(0) * TypeParam::d(1) * TypeParam::d(2);
+
+        run_single_stage(fill_functor(), stencil_backend_t(), grid, out);
+        EXPECT_EQ(size, out.reduce(reduction::plus()));
+        // reducing doesn't modify the buffer
+        EXPECT_EQ(size, out.reduce(reduction::plus()));
+
+        run_single_stage(fill_negative_functor(), stencil_backend_t(), grid, out);
+        EXPECT_EQ(-size, out.reduce(reduction::plus()));
+
+        // the padding should not contribute to max
+        out.rearm(std::numeric_limits<float_t>::lowest());
+        EXPECT_EQ(-1, out.reduce(reduction::max()));
+        out.rearm(0);
+        EXPECT_EQ(-size, out.reduce(reduction::plus()));
+
+        TypeParam::benchmark("reuse_reused", [&] {
+            run_single_stage(fill_functor(), stencil_backend_t(), grid, out);
+            return out.reduce(reduction::plus());
+        });
+        TypeParam::benchmark("reuse_fresh", [&] {
+            auto fresh = reduction::make_reducible<reduction_backend_t, storage_traits_t>(
+                float_t(0), TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
+            run_single_stage(fill_functor(), stencil_backend_t(), grid, fresh);
+            return fresh.reduce(reduction::plus());
+        });
+    }
+
+#if defined(GT_REDUCTION_NAIVE) || defined(GT_REDUCTION_CPU)
+    struct copy_functor {
+        using out = inout_accessor<0>;
+        using in = in_accessor<1>;
+        using param_list = make_param_list<out, in>;
+
+        template <class Eval>
+        GT_FUNCTION static void apply(Eval &&eval) {
+            eval(out()) = eval(in());
+        }
+    };
+
+    GT_REGRESSION_TEST(statistics, test_environment<>, reduction_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        // small integers, so that the sum is exact in any order
+        auto init = [](int i, int j, int k) { return float_t((i + 2 * j + 3 * k) % 5 - 2); };
+        auto out = reduction::make_reducible<reduction_backend_t, storage_traits_t>(
+            float_t(0), TypeParam::d(0), TypeParam::d(1), TypeParam::d(2));
+        run_single_stage(
+            copy_functor(), stencil_backend_t(), TypeParam::make_grid(), out, TypeParam::make_const_storage(init));
+
+        double expected_sum = 0;
+        float_t expected_min = init(0, 0, 0);
+        float_t expected_max = init(0, 0, 0);
+        for (int i = 0; i < TypeParam::d(0); ++i)
+            for (int j = 0; j < TypeParam::d(1); ++j)
+                for (int k = 0; k < TypeParam::d(2); ++k) {
+                    expected_sum += init(i, j, k);
+                    expected_min = std::min(expected_min, init(i, j, k));
+                    expected_max = std::max(expected_max, init(i, j, k));
+                }
+
+        auto [sum, lo, hi] = out.reduce(reduction::plus(), reduction::min(), reduction::max());
+        EXPECT_EQ(expected_sum, sum);
+        EXPECT_EQ(expected_min, lo);
+        EXPECT_EQ(expected_max, hi);
+
+        TypeParam::benchmark("statistics_fused",
+            [&] { return out.reduce(reduction::plus(), reduction::min(), reduction::max()); });
+        TypeParam::benchmark("statistics_separate", [&] {
+            return tuple(out.reduce(reduction::plus()), out.reduce(reduction::min()), out.reduce(reduction::max()));
+        });
+    }
+
+    GT_REGRESSION_TEST(location, test_environment<>, reduction_backend_t) {
+        using float_t = typename TypeParam::float_t;
+        int d0 = TypeParam::d(0), d1 = TypeParam::d(1), d2 = TypeParam::d(2);
+        auto init = [=](int i, int j, int k) {
+            if (i == 1 && j == d1 - 2 && k == d2 / 2)
+                return float_t(-100);
+            if (i == d0 - 1 && j == 0 && k == d2 - 1)
+                return float_t(100);
+            return float_t((i + 2 * j + 3 * k) % 5 - 2);
+        };
+        auto out = reduction::make_reducible<reduction_backend_t, storage_traits_t>(float_t(0), d0, d1, d2);
+        auto grid = TypeParam::make_grid();
+        run_single_stage(copy_functor(), stencil_backend_t(), grid, out, TypeParam::make_const_storage(init));
+
+        auto lo = out.locate(reduction::argmin());
+        ASSERT_TRUE(lo);
+        EXPECT_EQ(-100, lo->value);
+        EXPECT_EQ((array<int_t, 3>{1, d1 - 2, d2 / 2}), lo->index);
+
+        auto hi = out.locate(reduction::argmax());
+        ASSERT_TRUE(hi);
+        EXPECT_EQ(100, hi->value);
+        EXPECT_EQ((array<int_t, 3>{d0 - 1, 0, d2 - 1}), hi->index);
+
+        EXPECT_FALSE(out.locate(reduction::first_nan()));
+
+        auto with_nan = [=](int i, int j, int k) { return i == d0 / 2 && j == d1 / 3 && k == 1 ? NAN : init(i, j, k); };
+        run_single_stage(copy_functor(), stencil_backend_t(), grid, out, TypeParam::make_const_storage(with_nan));
+        auto nan = out.locate(reduction::first_nan());
+        ASSERT_TRUE(nan);
+        EXPECT_TRUE(std::isnan(nan->value));
+        EXPECT_EQ((array<int_t, 3>{d0 / 2, d1 / 3, 1}), nan->index);
+        // NaNs are ignored by argmin
+        EXPECT_EQ(lo->index, out.locate(reduction::argmin())->index);
+
+        TypeParam::benchmark("argmin", [&] { return out.locate(reduction::argmin()); });
+    }
+#endif
+
 } // namespace
@@ -0,0 +1,42 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <gridtools/storage/builder.hpp>
+
+#include <stencil_select.hpp>
+#include <test_environment.hpp>
+
+namespace {
+    using namespace gridtools;
+
+    auto fun = [](int i, int j, int k) { return i + 2 * j + 3 * k; };
+    auto masked_j_fun = [](int i, int, int k) { return i + 3 * k; };
+
+    template <class Env, int... Args, class Fun>
+    void test_layout(std::string const &name, Fun const &fun) {
+        auto make = [&] { return Env::builder().template layout<Args...>().initializer(fun).build(); };
+        auto ds = make();
+        Env::verify(fun, ds);
+        Env::benchmark(name, make);
+    }
+
+    GT_REGRESSION_TEST(storage_initializer, test_environment<>, stencil_backend_t) {
+        test_layout<TypeParam, 0, 1, 2>("storage_initializer_layout_012", fun);
+        test_layout<TypeParam, 2, 1, 0>("storage_initializer_layout_210", fun);
+        test_layout<TypeParam, 2, 0, 1>("storage_initializer_layout_201", fun);
+        test_layout<TypeParam, 1, 0, 2>("storage_initializer_layout_102", fun);
+        test_layout<TypeParam, 1, -1, 0>("storage_initializer_layout_1m0", masked_j_fun);
+        test_layout<TypeParam, 0, -1, 1>("storage_initializer_layout_0m1", masked_j_fun);
+    }
+} // namespace
@@ -8,6 +8,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <gridtools/boundaries/boundary.hpp>
@@ -46,6 +49,48 @@ struct bc_two {
     }
 };
 
+struct bc_direction {
+    template <sign I, sign J, sign K, typename DataField0>
+    GT_FUNCTION void operator()(direction<I, J, K>, DataField0 &data_field0, uint_t i, uint_t j, uint_t k) const {
+        data_field0(i, j, k) += 9 * (I + 1) + 3 * (J + 1) + K + 1;
+    }
+};
+
+// rejects the interior, which is not a boundary direction
+struct bc_no_interior {
+    template <sign I, sign J, sign K, typename DataField0>
+    GT_FUNCTION void operator()(direction<I, J, K>, DataField0 &data_field0, uint_t i, uint_t j, uint_t k) const {
+        static_assert(I != zero_ || J != zero_ || K != zero_, "the interior is not a boundary direction");
+        data_field0(i, j, k) = 9 * (I + 1) + 3 * (J + 1) + K + 1;
+    }
+};
+
+// sets the halo point to one more than the maximum of its neighbors in the other directions
+struct bc_ordered {
+    uint_t d[3], minus[3], plus[3];
+
+    int id(uint_t i, uint_t j, uint_t k) const {
+        auto region = [&](int n, uint_t x) { return x < minus[n] ? 0 : x < d[n] - plus[n] ? 1 : 2; };
+        return 9 * region(0, i) + 3 * region(1, j) + region(2, k);
+    }
+
+    template <typename DataField0>
+    void update(DataField0 &data_field0, uint_t i, uint_t j, uint_t k) const {
+        int_t res = 0;
+        for (uint_t x = i ? i - 1 : i; x <= i + 1 && x < d[0]; ++x)
+            for (uint_t y = j ? j - 1 : j; y <= j + 1 && y < d[1]; ++y)
+                for (uint_t z = k ? k - 1 : k; z <= k + 1 && z < d[2]; ++z)
+                    if (id(x, y, z) != id(i, j, k))
+                        res = std::max(res, data_field0(x, y, z));
+        data_field0(i, j, k) = res + 1;
+    }
+
+    template <typename Direction, typename DataField0>
+    void operator()(Direction, DataField0 &data_field0, uint_t i, uint_t j, uint_t k) const {
+        update(data_field0, i, j, k);
+    }
+};
+
 struct minus_predicate {
     template <sign I, sign J, sign K>
     bool operator()(direction<I, J, K>) const {
@@ -874,6 +919,118 @@ bool usingcopy_3() {
     return result;
 }
 
+template <int... Layout>
+bool all_directions() {
+    uint_t d[3] = {9, 7, 6};
+    uint_t minus[3] = {2, 1, 3};
+    uint_t plus[3] = {1, 3, 0};
+
+    auto in = storage::builder<storage_traits_t>
+                  .template type<int_t>()
+                  .template layout<Layout...>()
+                  .dimensions(d[0], d[1], d[2])
+                  .value(-1)();
+
+    array<halo_descriptor, 3> halos;
+    for (int n = 0; n < 3; ++n)
+        halos[n] = halo_descriptor(minus[n], plus[n], minus[n], d[n] - plus[n] - 1, d[n]);
+
+    boundary<bc_direction, gcl_arch_t>(halos, bc_direction()).apply(in);
+
+    auto inv = in->host_view();
+    auto region = [&](int n, uint_t x) { return x < minus[n] ? 0 : x < d[n] - plus[n] ? 1 : 2; };
+
+    // every halo point is visited exactly once with its direction, the interior is untouched
+    for (uint_t i = 0; i < d[0]; ++i)
+        for (uint_t j = 0; j < d[1]; ++j)
+            for (uint_t k = 0; k < d[2]; ++k) {
+                int id = 9 * region(0, i) + 3 * region(1, j) + region(2, k);
+                if (inv(i, j, k) != (id == 13 ? -1 : id - 1))
+                    return false;
+            }
+    return true;
+}
+
+#ifdef GT_GCL_CPU
+// the directions are applied one after another, so the later ones see the values of the earlier ones
+template <int... Layout>
+bool ordered_directions() {
+    bc_ordered bc = {{9, 7, 6}, {2, 1, 3}, {1, 3, 0}};
+    auto &d = bc.d;
+
+    auto in = storage::builder<storage_traits_t>
+                  .template type<int_t>()
+                  .template layout<Layout...>()
+                  .dimensions(d[0], d[1], d[2])
+                  .value(0)();
+
+    array<halo_descriptor, 3> halos;
+    for (int n = 0; n < 3; ++n)
+        halos[n] = halo_descriptor(bc.minus[n], bc.plus[n], bc.minus[n], d[n] - bc.plus[n] - 1, d[n]);
+
+    boundary<bc_ordered, gcl_arch_t>(halos, bc).apply(in);
+
+    // the reference applies the directions sequentially
+    std::vector<int_t> expected(d[0] * d[1] * d[2]);
+    auto ref = [&](uint_t i, uint_t j, uint_t k) -> int_t & { return expected[(i * d[1] + j) * d[2] + k]; };
+    for (int id = 0; id < 27; ++id)
+        for (uint_t i = 0; i < d[0]; ++i)
+            for (uint_t j = 0; j < d[1]; ++j)
+                for (uint_t k = 0; k < d[2]; ++k)
+                    if (id != 13 && bc.id(i, j, k) == id)
+                        bc.update(ref, i, j, k);
+
+    auto inv = in->host_view();
+    for (uint_t i = 0; i < d[0]; ++i)
+        for (uint_t j = 0; j < d[1]; ++j)
+            for (uint_t k = 0; k < d[2]; ++k)
+                if (inv(i, j, k) != ref(i, j, k))
+                    return false;
+    return true;
+}
+
+template <int... Layout>
+bool no_interior() {
+    uint_t d[3] = {7, 6, 5};
+    uint_t h[3] = {2, 1, 2};
+
+    auto in = storage::builder<storage_traits_t>
+                  .template type<int_t>()
+                  .template layout<Layout...>()
+                  .dimensions(d[0], d[1], d[2])
+                  .value(-1)();
+
+    array<halo_descriptor, 3> halos;
+    for (int n = 0; n < 3; ++n)
+        halos[n] = halo_descriptor(h[n], h[n], h[n], d[n] - h[n] - 1, d[n]);
+
+    boundary<bc_no_interior, gcl_arch_t>(halos, bc_no_interior()).apply(in);
+
+    auto region = [&](int n, uint_t x) { return x < h[n] ? 0 : x < d[n] - h[n] ? 1 : 2; };
+    auto inv = in->host_view();
+    for (uint_t i = 0; i < d[0]; ++i)
+        for (uint_t j = 0; j < d[1]; ++j)
+            for (uint_t k = 0; k < d[2]; ++k) {
+                int id = 9 * region(0, i) + 3 * region(1, j) + region(2, k);
+                if (inv(i, j, k) != (id == 13 ? -1 : id))
+                    return false;
+            }
+    return true;
+}
+
+TEST(boundaryconditions, no_interior_layout_012) { EXPECT_TRUE((no_interior<0, 1, 2>())); }
+
+TEST(boundaryconditions, no_interior_layout_210) { EXPECT_TRUE((no_interior<2, 1, 0>())); }
+
+TEST(boundaryconditions, ordered_directions_layout_012) { EXPECT_TRUE((ordered_directions<0, 1, 2>())); }
+
+TEST(boundaryconditions, ordered_directions_layout_210) { EXPECT_TRUE((ordered_directions<2, 1, 0>())); }
+#endif
+
+TEST(boundaryconditions, all_directions_layout_012) { EXPECT_TRUE((all_directions<0, 1, 2>())); }
+
+TEST(boundaryconditions, all_directions_layout_210) { EXPECT_TRUE((all_directions<2, 1, 0>())); }
+
 TEST(boundaryconditions, predicate) { EXPECT_EQ(predicate(), true); }
 
 TEST(boundaryconditions, twosurfaces) { EXPECT_EQ(twosurfaces(), true); }
@@ -75,6 +75,18 @@ namespace gridtools {
             hugepage_free(ptr);
         }
 
+        TEST_P(hugepage_alloc_fixture, calloc_free) {
+            std::size_t n = 1 << 20;
+
+            int *ptr = static_cast<int *>(hugepage_calloc(n * sizeof(int)));
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % hugepage_alloc_impl_::cache_line_size(), 0);
+
+            for (std::size_t i = 0; i < n; ++i)
+                EXPECT_EQ(ptr[i], 0);
+
+            hugepage_free(ptr);
+        }
+
         TEST_P(hugepage_alloc_fixture, offsets) {
             // test shifting of the allocated data: hugepage_alloc guarantees that consecutive allocations return
             // pointers with different last X bits to reduce number of cache set conflict misses
@@ -93,5 +93,18 @@ namespace gridtools::fn {
             static_assert(element_at<b, testee::sizes_t>::value == 4);
         } // namespace extents_enclosing_extents
 
+        namespace extents_add_extents {
+            using foo = extents<extent<a, -1, 1>, extent<b, 0, 1>>;
+            using bar = extents<extent<b, -2, 0>, extent<c, 1, 2>>;
+            using testee = add_extents<foo, bar>;
+
+            static_assert(std::is_same_v<testee, extents<extent<a, -1, 1>, extent<b, -2, 1>, extent<c, 1, 2>>>);
+            static_assert(testee::lower<b>() == -2);
+            static_assert(testee::upper<c>() == 2);
+            static_assert(!testee::is_zero);
+            static_assert(extents<extent<a, 0, 0>>::is_zero);
+            static_assert(extents<>::is_zero);
+        } // namespace extents_add_extents
+
     } // namespace test_extents_cpp
 } // namespace gridtools::fn
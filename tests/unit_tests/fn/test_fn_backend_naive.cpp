@@ -37,7 +37,8 @@ namespace gridtools::fn::backend {
             }
         };
 
-        TEST(backend_naive, apply_column_stage) {
+        template <class Backend>
+        void test_apply_column_stage(Backend be) {
             int in[5][7][3], out[5][7][3] = {};
             for (int i = 0; i < 5; ++i)
                 for (int j = 0; j < 7; ++j)
@@ -46,8 +47,8 @@ namespace gridtools::fn::backend {
 
             auto as_synthetic = [](int x[5][7][3]) {
                 return sid::synthetic()
-                    .set<property::origin>(sid::host_device::simple_ptr_holder(&x[0][0][0]))
-                    .set<property::strides>(tuple(21_c, 3_c, 1_c));
+                    .template set<property::origin>(sid::host_device::simple_ptr_holder(&x[0][0][0]))
+                    .template set<property::strides>(tuple(21_c, 3_c, 1_c));
             };
 
             auto composite = sid::composite::keys<int_t<0>, int_t<1>>::make_values(as_synthetic(out), as_synthetic(in));
@@ -56,7 +57,7 @@ namespace gridtools::fn::backend {
 
             column_stage<int_t<1>, sum_scan, 0, 1> cs;
 
-            apply_column_stage(naive(), sizes, cs, make_iterator_mock(), composite, int_t<1>(), tuple(42, 1));
+            apply_column_stage(be, sizes, cs, make_iterator_mock(), composite, int_t<1>(), tuple(42, 1));
 
             for (int i = 0; i < 5; ++i)
                 for (int k = 0; k < 3; ++k) {
@@ -68,6 +69,15 @@ namespace gridtools::fn::backend {
                 }
         }
 
+        TEST(backend_naive, apply_column_stage) { test_apply_column_stage(naive()); }
+
+        // five columns along the first horizontal dimension: the last block is partially filled
+        TEST(backend_naive, apply_column_stage_lanes) {
+            test_apply_column_stage(naive_column_lanes<2>());
+            test_apply_column_stage(naive_column_lanes<4>());
+            test_apply_column_stage(naive_column_lanes<8>());
+        }
+
         TEST(backend_naive, global_tmp) {
             auto alloc = tmp_allocator(naive());
             auto sizes = hymap::keys<int_t<0>, int_t<1>, int_t<2>>::values<int_t<5>, int_t<7>, int_t<3>>();
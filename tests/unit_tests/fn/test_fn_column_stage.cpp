@@ -44,6 +44,36 @@ namespace gridtools::fn {
             }
         };
 
+        using vdim_t = integral_constant<int, 0>;
+
+        // out[k] = in[k - 1] + in[k] + in[k + 1], the input is passed twice to check the window lookup by position
+        template <class Base>
+        struct window_sum_scan : Base {
+            using vertical_windows = meta::list<vertical_window<1, -1, 1>>;
+
+            static GT_FUNCTION constexpr auto prologue() {
+                return nvcc_workarounds::make_1_tuple(scan_pass(
+                    [](auto acc, auto const &, auto const &iter) {
+                        return acc + *iter + *shift(iter, vdim_t(), Base::value ? -1 : 1);
+                    },
+                    [](auto acc) { return acc; }));
+            }
+            static GT_FUNCTION constexpr auto body() {
+                return scan_pass(
+                    [](auto acc, auto const &, auto const &iter) {
+                        return acc + *shift(iter, vdim_t(), -1) + *iter + *shift(iter, vdim_t(), 1);
+                    },
+                    [](auto acc) { return acc; });
+            }
+            static GT_FUNCTION constexpr auto epilogue() {
+                return nvcc_workarounds::make_1_tuple(scan_pass(
+                    [](auto acc, auto const &, auto const &iter) {
+                        return acc + *iter + *shift(iter, vdim_t(), Base::value ? 1 : -1);
+                    },
+                    [](auto acc) { return acc; }));
+            }
+        };
+
         struct make_iterator_mock {
             auto GT_FUNCTION operator()() const {
                 return [](auto tag, auto const &ptr, auto const & /*strides*/) { return at_key<decltype(tag)>(ptr); };
@@ -52,7 +82,6 @@ namespace gridtools::fn {
 
         TEST(scan, smoke) {
             using column_t = int[5];
-            using vdim_t = integral_constant<int, 0>;
 
             column_t a = {0, 0, 0, 0, 0};
             column_t b = {1, 2, 3, 4, 5};
@@ -99,5 +128,72 @@ namespace gridtools::fn {
             }
         }
 
+        TEST(scan, vertical_window) {
+            using column_t = int[5];
+
+            column_t a = {0, 0, 0, 0, 0};
+            column_t b = {1, 2, 4, 8, 16};
+            auto composite = sid::composite::keys<integral_constant<int, 0>, integral_constant<int, 1>>::make_values(
+                sid::synthetic()
+                    .set<property::origin>(sid::host_device::simple_ptr_holder(&a[0]))
+                    .set<property::strides>(tuple(1_c)),
+                sid::synthetic()
+                    .set<property::origin>(sid::host_device::simple_ptr_holder(&b[0]))
+                    .set<property::strides>(tuple(1_c)));
+            auto ptr = sid::get_origin(composite)();
+            auto strides = sid::get_strides(composite);
+
+            // the scan accumulates the window sums, so out[k] is the sum of them up to the level k
+            {
+                column_stage<vdim_t, window_sum_scan<fwd>, 0, 1, 1> cs;
+                auto res = cs(0, 5, make_iterator_mock()(), ptr, strides);
+                int expected[5] = {3, 10, 24, 52, 76};
+                for (std::size_t i = 0; i < 5; ++i)
+                    EXPECT_EQ(a[i], expected[i]);
+                EXPECT_EQ(res, 76);
+            }
+            {
+                column_stage<vdim_t, window_sum_scan<bwd>, 0, 1, 1> cs;
+                auto res = cs(0, 5, make_iterator_mock()(), ptr, strides);
+                int expected[5] = {76, 73, 66, 52, 24};
+                for (std::size_t i = 0; i < 5; ++i)
+                    EXPECT_EQ(a[i], expected[i]);
+                EXPECT_EQ(res, 76);
+            }
+        }
+
+        TEST(scan, lanes) {
+            int a[3][5] = {};
+            int b[3][5] = {{1, 2, 4, 8, 16}, {0, 1, 0, 1, 0}, {5, 4, 3, 2, 1}};
+            auto as_synthetic = [](int x[3][5]) {
+                return sid::synthetic()
+                    .set<property::origin>(sid::host_device::simple_ptr_holder(&x[0][0]))
+                    .set<property::strides>(tuple(1_c, 5_c));
+            };
+            auto composite = sid::composite::keys<integral_constant<int, 0>, integral_constant<int, 1>>::make_values(
+                as_synthetic(a), as_synthetic(b));
+            auto ptr = sid::get_origin(composite)();
+            auto strides = sid::get_strides(composite);
+            auto const &lane_stride = sid::get_stride<integral_constant<int, 1>>(strides);
+
+            auto check = [&](auto cs, auto lanes) {
+                for (auto &column : a)
+                    for (auto &x : column)
+                        x = 0;
+                cs.template lanes<decltype(lanes)::value>(0, 5, 3, make_iterator_mock()(), ptr, strides, lane_stride);
+                for (int c = 0; c < 3; ++c) {
+                    int res = 0;
+                    for (int k = 0; k < 5; ++k) {
+                        res += (k > 0 ? b[c][k - 1] : 0) + b[c][k] + (k < 4 ? b[c][k + 1] : 0);
+                        EXPECT_EQ(a[c][k], res);
+                    }
+                }
+            };
+
+            using scan_t = column_stage<vdim_t, window_sum_scan<fwd>, 0, 1, 1>;
+            static_assert(scan_t::has_lanes<int, decltype(make_iterator_mock()()), decltype(ptr), decltype(strides)>);
+            check(scan_t(), integral_constant<int, 3>());
+            check(scan_t(), integral_constant<int, 4>());
+        }
     } // namespace
 } // namespace gridtools::fn
@@ -0,0 +1,50 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gridtools/fn/csr_neighbor_table.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace gridtools::fn {
+    namespace {
+        std::array<int, 3> const aos[4] = {{1, 2, -1}, {0, 2, 3}, {-1, 0, 1}, {1, -1, -1}};
+        // the neighbors of the CSR table move to the front of the list
+        std::array<int, 3> const expected[4] = {{1, 2, -1}, {0, 2, 3}, {0, 1, -1}, {1, -1, -1}};
+
+        template <class T>
+        void check() {
+            auto data = csr_neighbor_table::make_data<T>(&aos[0], 4);
+            EXPECT_EQ(data.offsets, (std::vector<int>{0, 2, 5, 7, 8}));
+            EXPECT_EQ(data.targets.size(), 8);
+            auto testee = csr_neighbor_table::as_neighbor_table<3>(data.offsets.data(), data.targets.data());
+            for (int i = 0; i != 4; ++i) {
+                auto neighbors = neighbor_table::neighbors(testee, i);
+                for (int n = 0; n != 3; ++n)
+                    EXPECT_EQ(neighbors[n], expected[i][n]);
+                EXPECT_EQ(neighbor_table::neighbor<0>(testee, i), expected[i][0]);
+                EXPECT_EQ(neighbor_table::neighbor<1>(testee, i), expected[i][1]);
+                EXPECT_EQ(neighbor_table::neighbor<2>(testee, i), expected[i][2]);
+            }
+        }
+
+        TEST(csr_neighbor_table, int) { check<int>(); }
+        TEST(csr_neighbor_table, int16) { check<std::int16_t>(); }
+
+        TEST(csr_neighbor_table, overflow) {
+            std::array<int, 1> const large[2] = {{1}, {40000}};
+            EXPECT_THROW(csr_neighbor_table::make_data<std::int16_t>(&large[0], 2), std::out_of_range);
+        }
+    } // namespace
+} // namespace gridtools::fn
@@ -9,6 +9,13 @@
  */
 #include <gridtools/fn/executor.hpp>
 
+#include <atomic>
+#include <chrono>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <gtest/gtest.h>
 
 #include <gridtools/fn/backend/naive.hpp>
@@ -28,6 +35,12 @@ namespace gridtools::fn {
             }
         };
 
+        struct pointwise_stencil : pointwise {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &iter) { return 2 * *iter; };
+            }
+        };
+
         struct fwd_sum_scan : fwd {
             static GT_FUNCTION constexpr auto body() {
                 return scan_pass([](auto acc, auto const &iter) { return acc + *iter; }, [](auto acc) { return acc; });
@@ -72,6 +85,230 @@ namespace gridtools::fn {
                 }
         }
 
+        TEST(stencil_executor, fused) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(2_c, 3_c);
+
+            int a[2][3] = {}, b[2][3] = {}, c[2][3] = {}, d[2][3];
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j)
+                    d[i][j] = 3 * i + j;
+
+            // all stages are pointwise and fused, the later ones read and overwrite the arguments of the earlier ones
+            make_stencil_executor(backend_t(), domain, std::tuple<>(), make_iterator_mock())
+                .arg(a)
+                .arg(b)
+                .arg(c)
+                .arg(d)
+                .assign(0_c, pointwise_stencil(), 3_c)
+                .assign(1_c, pointwise_stencil(), 3_c)
+                .assign(2_c, pointwise_stencil(), 1_c)
+                .assign(3_c, pointwise_stencil(), 2_c)
+                .execute();
+
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j) {
+                    EXPECT_EQ(a[i][j], (3 * i + j) * 2);
+                    EXPECT_EQ(b[i][j], (3 * i + j) * 2);
+                    EXPECT_EQ(c[i][j], (3 * i + j) * 4);
+                    EXPECT_EQ(d[i][j], (3 * i + j) * 8);
+                }
+        }
+
+        struct next_stencil {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &iter) { return 2 * *(iter + 1); };
+            }
+        };
+
+        // the same array is passed twice: written by the first stage and read shifted by the second one
+        TEST(stencil_executor, aliased) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(2_c, 3_c);
+
+            int a[2][4], b[2][4] = {}, c[2][4];
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 4; ++j) {
+                    a[i][j] = -1;
+                    c[i][j] = 4 * i + j;
+                }
+
+            make_stencil_executor(backend_t(), domain, std::tuple<>(), make_iterator_mock())
+                .arg(a)
+                .arg(a)
+                .arg(b)
+                .arg(c)
+                .assign(0_c, pointwise_stencil(), 3_c)
+                .assign(2_c, next_stencil(), 1_c)
+                .execute();
+
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j)
+                    EXPECT_EQ(b[i][j], j < 2 ? 4 * (4 * i + j + 1) : -2);
+        }
+
+        TEST(stencil_executor, prepared) {
+            using backend_t = backend::naive;
+            // the second row only
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(1_c, 3_c);
+            auto offsets = hymap::keys<int_t<0>>::make_values(1_c);
+
+            int a[2][3] = {}, b[2][3], c[2][3] = {}, d[2][3];
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j) {
+                    b[i][j] = 3 * i + j;
+                    d[i][j] = 5 * i + j;
+                }
+
+            auto prepared = make_stencil_executor(backend_t(), domain, offsets, make_iterator_mock())
+                                .arg(a)
+                                .arg(b)
+                                .assign(0_c, stencil(), 1_c)
+                                .prepare();
+
+            prepared.execute();
+            for (int j = 0; j < 3; ++j) {
+                EXPECT_EQ(a[0][j], 0);
+                EXPECT_EQ(a[1][j], (3 + j) * 2);
+            }
+
+            prepared.execute(c, d);
+            for (int j = 0; j < 3; ++j) {
+                EXPECT_EQ(c[0][j], 0);
+                EXPECT_EQ(c[1][j], (5 + j) * 2);
+                EXPECT_EQ(a[1][j], (3 + j) * 2);
+            }
+        }
+
+        TEST(stencil_executor, async) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(2_c, 3_c);
+
+            int a[2][3] = {}, b[2][3] = {}, c[2][3] = {}, d[2][3];
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j)
+                    d[i][j] = 3 * i + j;
+
+            auto executor = [&] {
+                return make_stencil_executor(backend_t(), domain, std::tuple<>(), make_iterator_mock());
+            };
+
+            // the first two executions are independent, the third one reads their outputs
+            auto a_done = executor().arg(a).arg(d).assign(0_c, stencil(), 1_c).execute_async();
+            auto b_done = executor().arg(b).arg(d).assign(0_c, stencil(), 1_c).execute_async();
+            auto c_done = executor()
+                              .arg(c)
+                              .arg(a)
+                              .arg(b)
+                              .assign(0_c, stencil(), 1_c)
+                              .assign(0_c, stencil(), 2_c)
+                              .execute_async(a_done, b_done);
+            c_done.wait();
+
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j) {
+                    EXPECT_EQ(a[i][j], (3 * i + j) * 2);
+                    EXPECT_EQ(b[i][j], (3 * i + j) * 2);
+                    EXPECT_EQ(c[i][j], (3 * i + j) * 4);
+                }
+        }
+
+#ifdef _OPENMP
+        std::atomic<int> arrivals = 0;
+        std::atomic<bool> timed_out = false;
+
+        // waits until the other execution arrives here as well
+        struct rendezvous_stencil {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &iter) {
+                    ++arrivals;
+                    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                    while (arrivals < 2)
+                        if (std::chrono::steady_clock::now() > deadline) {
+                            timed_out = true;
+                            break;
+                        }
+                    return *iter;
+                };
+            }
+        };
+
+        TEST(stencil_executor, async_overlap) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(1_c, 1_c);
+
+            int a[1][1] = {}, b[1][1] = {}, c[1][1] = {{1}}, d[1][1] = {{2}};
+            arrivals = 0;
+            timed_out = false;
+
+            auto executor = [&] {
+                return make_stencil_executor(backend_t(), domain, std::tuple<>(), make_iterator_mock());
+            };
+
+            auto first = executor().arg(a).arg(c).assign(0_c, rendezvous_stencil(), 1_c).execute_async();
+            auto second = executor().arg(b).arg(d).assign(0_c, rendezvous_stencil(), 1_c).execute_async();
+            first.get();
+            second.get();
+
+            EXPECT_FALSE(timed_out);
+            EXPECT_EQ(a[0][0], 1);
+            EXPECT_EQ(b[0][0], 2);
+        }
+
+        TEST(stencil_executor, async_pending_dependency) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(1_c, 1_c);
+
+            int a[1][1] = {}, b[1][1] = {}, c[1][1] = {{1}}, d[1][1] = {{2}}, e[1][1] = {};
+            arrivals = 0;
+            timed_out = false;
+
+            auto executor = [&] {
+                return make_stencil_executor(backend_t(), domain, std::tuple<>(), make_iterator_mock());
+            };
+
+            // the dependent execution is submitted before `second` but must not occupy a worker until `first` is done,
+            // otherwise `first` and `second` can't meet
+            auto first = executor().arg(a).arg(c).assign(0_c, rendezvous_stencil(), 1_c).execute_async();
+            auto dependent = executor().arg(e).arg(a).assign(0_c, stencil(), 1_c).execute_async(first);
+            auto second = executor().arg(b).arg(d).assign(0_c, rendezvous_stencil(), 1_c).execute_async();
+            dependent.get();
+            second.get();
+
+            EXPECT_FALSE(timed_out);
+            EXPECT_EQ(e[0][0], 2);
+            EXPECT_EQ(b[0][0], 2);
+        }
+
+        std::atomic<int> region_threads = 0;
+
+        struct thread_count_stencil {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &iter) {
+                    region_threads = omp_get_num_threads();
+                    return *iter;
+                };
+            }
+        };
+
+        TEST(stencil_executor, async_alone_uses_all_threads) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(1_c, 1_c);
+
+            int a[1][1] = {}, b[1][1] = {{1}};
+
+            make_stencil_executor(backend_t(), domain, std::tuple<>(), make_iterator_mock())
+                .arg(a)
+                .arg(b)
+                .assign(0_c, thread_count_stencil(), 1_c)
+                .execute_async()
+                .get();
+
+            EXPECT_EQ(region_threads, omp_get_max_threads());
+            EXPECT_EQ(a[0][0], 1);
+        }
+#endif
+
         TEST(vertical_executor, smoke) {
             using backend_t = backend::naive;
             auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(2_c, 3_c);
@@ -103,5 +340,67 @@ namespace gridtools::fn {
                 }
             }
         }
+
+        TEST(vertical_executor, prepared) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(2_c, 3_c);
+
+            int a[2][3] = {}, b[2][3], c[2][3] = {}, d[2][3];
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j) {
+                    b[i][j] = 3 * i + j;
+                    d[i][j] = 5 * i + j;
+                }
+
+            auto prepared = make_vertical_executor<int_t<1>>(backend_t(), domain, std::tuple<>(), make_iterator_mock())
+                                .arg(a)
+                                .arg(b)
+                                .assign(0_c, fwd_sum_scan(), 42, 1_c)
+                                .prepare();
+
+            for (int repetition = 0; repetition < 2; ++repetition) {
+                prepared.execute(c, d);
+                prepared.execute();
+                for (int i = 0; i < 2; ++i) {
+                    int res_a = 42, res_c = 42;
+                    for (int j = 0; j < 3; ++j) {
+                        res_a += b[i][j];
+                        res_c += d[i][j];
+                        EXPECT_EQ(a[i][j], res_a);
+                        EXPECT_EQ(c[i][j], res_c);
+                    }
+                }
+            }
+        }
+
+        TEST(vertical_executor, async) {
+            using backend_t = backend::naive;
+            auto domain = hymap::keys<int_t<0>, int_t<1>>::make_values(2_c, 3_c);
+
+            int a[2][3] = {}, b[2][3] = {}, c[2][3];
+            for (int i = 0; i < 2; ++i)
+                for (int j = 0; j < 3; ++j)
+                    c[i][j] = 3 * i + j;
+
+            auto executor = [&] {
+                return make_vertical_executor<int_t<1>>(backend_t(), domain, std::tuple<>(), make_iterator_mock());
+            };
+
+            auto b_done = executor().arg(b).arg(c).assign(0_c, fwd_sum_scan(), 42, 1_c).execute_async();
+            executor().arg(a).arg(b).assign(0_c, bwd_sum_scan(), 8, 1_c).execute_async(b_done).get();
+
+            for (int i = 0; i < 2; ++i) {
+                int res = 42;
+                for (int j = 0; j < 3; ++j) {
+                    res += c[i][j];
+                    EXPECT_EQ(b[i][j], res);
+                }
+                res = 8;
+                for (int j = 2; j >= 0; --j) {
+                    res += b[i][j];
+                    EXPECT_EQ(a[i][j], res);
+                }
+            }
+        }
     } // namespace
 } // namespace gridtools::fn
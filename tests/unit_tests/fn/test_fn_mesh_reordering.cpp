@@ -0,0 +1,106 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <gridtools/fn/mesh_reordering.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace gridtools::fn::mesh_reordering {
+    namespace {
+        TEST(mesh_reordering, permutation) {
+            permutation testee({2, 0, 1});
+            EXPECT_EQ(testee.old_to_new(), (std::vector<int>{1, 2, 0}));
+            EXPECT_EQ(testee.inverse().new_to_old(), testee.old_to_new());
+            EXPECT_EQ(compose(testee, testee.inverse()).new_to_old(), permutation::identity(3).new_to_old());
+            EXPECT_EQ(compose(testee, testee).new_to_old(), (std::vector<int>{1, 2, 0}));
+            EXPECT_THROW(permutation({0, 0, 1}), std::invalid_argument);
+            EXPECT_THROW(permutation({0, 3, 1}), std::invalid_argument);
+        }
+
+        // a path 0 - 1 - ... - 7 numbered in a scrambled order
+        std::array<int, 2> const v2v[8] = {
+            {3, 5}, {6, -1}, {4, 7}, {0, 7}, {2, 6}, {0, -1}, {1, 4}, {2, 3}};
+
+        int bandwidth(std::vector<std::array<int, 2>> const &table) {
+            int res = 0;
+            for (int i = 0; i != int(table.size()); ++i)
+                for (int j : table[i])
+                    if (j != -1)
+                        res = std::max(res, std::abs(i - j));
+            return res;
+        }
+
+        TEST(mesh_reordering, reverse_cuthill_mckee) {
+            auto perm = reverse_cuthill_mckee(8, &v2v[0]);
+            ASSERT_EQ(perm.size(), 8);
+            auto renumbered = renumber(&v2v[0], perm, perm);
+            std::vector<std::array<int, 2>> table;
+            for (auto &&neighbors : renumbered)
+                table.push_back({neighbors[0], neighbors[1]});
+            EXPECT_EQ(bandwidth(std::vector<std::array<int, 2>>(std::begin(v2v), std::end(v2v))), 5);
+            EXPECT_EQ(bandwidth(table), 1);
+            // the order of the neighbors is kept
+            for (int i = 0; i != 8; ++i)
+                for (int n = 0; n != 2; ++n) {
+                    int old = v2v[perm.new_to_old(i)][n];
+                    EXPECT_EQ(table[i][n], old == -1 ? -1 : perm.old_to_new(old));
+                }
+        }
+
+        TEST(mesh_reordering, reverse_cuthill_mckee_via_other_location) {
+            // a chain of 4 vertices connected by 3 edges, vertices and edges are scrambled
+            std::array<int, 2> const v2e[4] = {{2, -1}, {0, 1}, {1, 2}, {0, -1}};
+            std::array<int, 2> const e2v[3] = {{1, 3}, {1, 2}, {0, 2}};
+            auto v_perm = reverse_cuthill_mckee(4, &v2e[0], &e2v[0]);
+            auto e_perm = induced_permutation(3, &e2v[0], v_perm);
+            auto renumbered = renumber(&e2v[0], e_perm, v_perm);
+            for (int e = 0; e != 3; ++e) {
+                int lo = std::min(renumbered[e][0], renumbered[e][1]);
+                int hi = std::max(renumbered[e][0], renumbered[e][1]);
+                EXPECT_EQ(lo, e);
+                EXPECT_EQ(hi, e + 1);
+            }
+        }
+
+        TEST(mesh_reordering, space_filling_curve) {
+            std::array<double, 2> coords[] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+            auto perm = space_filling_curve(4, [&](int i) { return coords[i]; });
+            EXPECT_EQ(perm.new_to_old(), (std::vector<int>{0, 3, 2, 1}));
+        }
+
+        TEST(mesh_reordering, permute) {
+            int src[3][4], tmp[3][4], dst[3][4];
+            for (int i = 0; i != 3; ++i)
+                for (int k = 0; k != 4; ++k)
+                    src[i][k] = 10 * i + k;
+            permutation perm({1, 2, 0});
+            permute(perm, src, tmp, 4);
+            for (int i = 0; i != 3; ++i)
+                for (int k = 0; k != 4; ++k)
+                    EXPECT_EQ(tmp[i][k], src[perm.new_to_old(i)][k]);
+            unpermute(perm, tmp, dst, 4);
+            for (int i = 0; i != 3; ++i)
+                for (int k = 0; k != 4; ++k)
+                    EXPECT_EQ(dst[i][k], src[i][k]);
+        }
+
+        TEST(mesh_reordering, permute_without_vertical_dimension) {
+            double src[3] = {1, 2, 3}, dst[3] = {};
+            permute(permutation({2, 0, 1}), src, dst);
+            EXPECT_EQ(dst[0], 3);
+            EXPECT_EQ(dst[1], 1);
+            EXPECT_EQ(dst[2], 2);
+        }
+    } // namespace
+} // namespace gridtools::fn::mesh_reordering
@@ -28,4 +28,13 @@ namespace gridtools::fn {
         for (int i = 0; i < 3; ++i)
             EXPECT_EQ(table[i], neighbor_table::neighbors(table, i));
     }
+
+    TEST(neighbor_table, neighbor) {
+        std::array<int, 2> table[3] = {{1, 2}, {3, 4}, {4, 5}};
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(table[i][0], neighbor_table::neighbor<0>(table, i));
+            EXPECT_EQ(table[i][1], neighbor_table::neighbor<1>(table, i));
+        }
+        EXPECT_EQ(42, neighbor_table::neighbor<2>(a_neighbor_table(), 0));
+    }
 } // namespace gridtools::fn
@@ -39,6 +39,9 @@ namespace gridtools::fn {
             EXPECT_EQ(n11, 11);
             EXPECT_EQ(n20, 20);
             EXPECT_EQ(n21, 21);
+
+            EXPECT_EQ(neighbor_table::neighbor<0>(table, 1), 10);
+            EXPECT_EQ(neighbor_table::neighbor<1>(table, 2), 21);
         }
 
     } // namespace
@@ -0,0 +1,50 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gridtools/fn/soa_neighbor_table.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace gridtools::fn {
+    namespace {
+        std::array<int, 3> const aos[4] = {{1, 2, -1}, {0, 2, 3}, {0, 1, -1}, {1, -1, -1}};
+
+        static_assert(neighbor_table::is_neighbor_table<soa_neighbor_table::soa_neighbor_table_impl_::
+                soa_neighbor_table<std::int16_t, 3>>());
+
+        template <class T>
+        void check(int stride) {
+            auto data = soa_neighbor_table::make_data<T>(&aos[0], 4, stride);
+            ASSERT_EQ(data.size(), 3 * std::max(stride, 4));
+            auto testee = soa_neighbor_table::as_neighbor_table<3>(data.data(), std::max(stride, 4));
+            for (int i = 0; i != 4; ++i) {
+                auto neighbors = neighbor_table::neighbors(testee, i);
+                for (int n = 0; n != 3; ++n)
+                    EXPECT_EQ(neighbors[n], aos[i][n]);
+                EXPECT_EQ(neighbor_table::neighbor<0>(testee, i), aos[i][0]);
+                EXPECT_EQ(neighbor_table::neighbor<1>(testee, i), aos[i][1]);
+                EXPECT_EQ(neighbor_table::neighbor<2>(testee, i), aos[i][2]);
+            }
+        }
+
+        TEST(soa_neighbor_table, int) { check<int>(0); }
+        TEST(soa_neighbor_table, int16) { check<std::int16_t>(0); }
+        TEST(soa_neighbor_table, padded) { check<int>(8); }
+
+        TEST(soa_neighbor_table, overflow) {
+            std::array<int, 1> const large[2] = {{1}, {40000}};
+            EXPECT_THROW(soa_neighbor_table::make_data<std::int16_t>(&large[0], 2), std::out_of_range);
+        }
+    } // namespace
+} // namespace gridtools::fn
@@ -28,6 +28,23 @@ namespace gridtools::fn {
             }
         };
 
+        struct pointwise_stencil : pointwise {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &iter) { return 2 * *iter; };
+            }
+        };
+
+        struct dim_a;
+
+        template <int L, int U>
+        struct shifted_stencil {
+            using extents_t = extents<extent<dim_a, L, U>>;
+
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &iter) { return 2 * *iter; };
+            }
+        };
+
         struct make_iterator_mock {
             GT_FUNCTION auto operator()() const {
                 return [](auto tag, auto const &ptr, auto const & /*strides*/) { return at_key<decltype(tag)>(ptr); };
@@ -59,5 +76,44 @@ namespace gridtools::fn {
             EXPECT_EQ(out[0], 336);
         }
 
+        // pointwise stages are fused, whatever they read and write
+        static_assert(std::is_same_v<fuse_stencil_stages<meta::list<stencil_stage<pointwise_stencil, 0, 2>,
+                                         stencil_stage<pointwise_stencil, 1, 0>,
+                                         stencil_stage<pointwise_stencil, 2, 1>>>,
+            meta::list<merged_stencil_stage<stencil_stage<pointwise_stencil, 0, 2>,
+                stencil_stage<pointwise_stencil, 1, 0>,
+                stencil_stage<pointwise_stencil, 2, 1>>>>);
+
+        // the other stages are never fused, even if they look independent: their arguments may alias
+        static_assert(std::is_same_v<fuse_stencil_stages<meta::list<stencil_stage<stencil, 0, 2>,
+                                         stencil_stage<stencil, 1, 3>>>,
+            meta::list<merged_stencil_stage<stencil_stage<stencil, 0, 2>>,
+                merged_stencil_stage<stencil_stage<stencil, 1, 3>>>>);
+
+        // a stage which is not pointwise separates the groups
+        static_assert(std::is_same_v<fuse_stencil_stages<meta::list<stencil_stage<pointwise_stencil, 0, 3>,
+                                         stencil_stage<pointwise_stencil, 1, 3>,
+                                         stencil_stage<stencil, 2, 1>,
+                                         stencil_stage<pointwise_stencil, 3, 2>>>,
+            meta::list<merged_stencil_stage<stencil_stage<pointwise_stencil, 0, 3>,
+                           stencil_stage<pointwise_stencil, 1, 3>>,
+                merged_stencil_stage<stencil_stage<stencil, 2, 1>>,
+                merged_stencil_stage<stencil_stage<pointwise_stencil, 3, 2>>>>);
+
+        // the temporary 2 is computed where the last stage reads it, the temporary 1 is extended further by that
+        namespace block_stages {
+            using testee = block_stencil_stages<meta::list<stencil_stage<shifted_stencil<-1, 0>, 1, 3>,
+                                                    stencil_stage<shifted_stencil<0, 2>, 2, 1>,
+                                                    stencil_stage<shifted_stencil<-1, 1>, 0, 2>>,
+                meta::list<int_t<1>, int_t<2>>>;
+
+            static_assert(std::is_same_v<testee::tmp_extents_t<int_t<2>>, extents<extent<dim_a, -1, 1>>>);
+            static_assert(std::is_same_v<testee::tmp_extents_t<int_t<1>>, extents<extent<dim_a, -1, 3>>>);
+            static_assert(std::is_same_v<testee::stages_t,
+                meta::list<blocked_stencil_stage<stencil_stage<shifted_stencil<-1, 0>, 1, 3>,
+                               extents<extent<dim_a, -1, 3>>>,
+                    blocked_stencil_stage<stencil_stage<shifted_stencil<0, 2>, 2, 1>, extents<extent<dim_a, -1, 1>>>,
+                    blocked_stencil_stage<stencil_stage<shifted_stencil<-1, 1>, 0, 2>, extents<>>>>);
+        } // namespace block_stages
     } // namespace
 } // namespace gridtools::fn
@@ -0,0 +1,80 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <gridtools/fn/tridiagonal.hpp>
+
+#include <gtest/gtest.h>
+
+#include <gridtools/sid/synthetic.hpp>
+
+namespace gridtools::fn {
+    namespace {
+        using namespace literals;
+        using sid::property;
+
+        template <int I>
+        using int_t = integral_constant<int, I>;
+
+        constexpr int columns = 3;
+        constexpr int levels = 50;
+
+        using field_t = double[columns][levels];
+
+        auto as_synthetic(field_t &x) {
+            return sid::synthetic()
+                .set<property::origin>(sid::host_device::simple_ptr_holder(&x[0][0]))
+                .set<property::strides>(tuple(int_t<levels>(), 1_c));
+        }
+
+        void test_solve(tridiagonal_algorithm algorithm, int segments = 0) {
+            field_t a, b, c, d, x = {};
+            for (int i = 0; i < columns; ++i)
+                for (int k = 0; k < levels; ++k) {
+                    a[i][k] = -1 - (i + k) % 3;
+                    c[i][k] = 1 + (2 * i + k) % 5;
+                    b[i][k] = 8 + (i * k) % 7;
+                    d[i][k] = (k * 7 + i) % 11 - 5;
+                }
+            auto sizes = hymap::keys<int_t<0>, int_t<1>>::values(columns, levels);
+            tridiagonal_solve<int_t<1>>(backend::naive(),
+                sizes,
+                as_synthetic(a),
+                as_synthetic(b),
+                as_synthetic(c),
+                as_synthetic(d),
+                as_synthetic(x),
+                algorithm,
+                segments);
+            for (int i = 0; i < columns; ++i)
+                for (int k = 0; k < levels; ++k) {
+                    double res = b[i][k] * x[i][k];
+                    if (k > 0)
+                        res += a[i][k] * x[i][k - 1];
+                    if (k < levels - 1)
+                        res += c[i][k] * x[i][k + 1];
+                    EXPECT_NEAR(res, d[i][k], 1e-12) << "column " << i << ", level " << k;
+                }
+        }
+
+        TEST(tridiagonal, thomas) { test_solve(tridiagonal_algorithm::thomas); }
+
+        TEST(tridiagonal, automatic) { test_solve(tridiagonal_algorithm::automatic); }
+
+        TEST(tridiagonal, partitioned) {
+            test_solve(tridiagonal_algorithm::partitioned);
+            // the number of levels is not divisible by the number of segments
+            test_solve(tridiagonal_algorithm::partitioned, 2);
+            test_solve(tridiagonal_algorithm::partitioned, 7);
+            // the shortest segments of three levels
+            test_solve(tridiagonal_algorithm::partitioned, levels / 3);
+            // too many segments are limited to that
+            test_solve(tridiagonal_algorithm::partitioned, levels);
+        }
+    } // namespace
+} // namespace gridtools::fn
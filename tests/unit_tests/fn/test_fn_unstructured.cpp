@@ -101,5 +101,161 @@ namespace gridtools::fn {
                 }
         }
 
+        template <class C>
+        struct reduce_stencil {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &in) { return reduce_neighbors(C(), std::plus<>(), 0, in); };
+            }
+        };
+
+        struct weighted_reduce_stencil {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &weights, auto const &a, auto const &b) {
+                    return reduce_neighbors(
+                        v2v(),
+                        [](int acc, int w, int x, int y) { return acc + w * x * y; },
+                        1,
+                        neighbor_weights(deref(weights)),
+                        a,
+                        b);
+                };
+            }
+        };
+
+        struct tuple_reduce_stencil {
+            GT_FUNCTION constexpr auto operator()() const {
+                return [](auto const &in) {
+                    auto res = reduce_neighbors(
+                        v2v(),
+                        [](tuple<int, int> acc, int x) {
+                            return tuple<int, int>(get<0>(acc) + x, get<1>(acc) + 1);
+                        },
+                        tuple<int, int>(0, 0),
+                        in);
+                    return 10 * get<0>(res) + get<1>(res);
+                };
+            }
+        };
+
+        std::array<int, 3> const reduce_v2v_table[3] = {{1, 2, -1}, {-1, 0, 2}, {0, -1, -1}};
+
+        TEST(unstructured, reduce_neighbors) {
+            int in[3][5], out[3][5] = {};
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k)
+                    in[v][k] = 5 * v + k;
+
+            auto domain = unstructured_domain({3, 5}, {}, connectivity<v2v>(&reduce_v2v_table[0]));
+            auto backend = make_backend(backend::naive(), domain);
+            backend.stencil_executor()().arg(out).arg(in).assign(0_c, reduce_stencil<v2v>(), 1_c).execute();
+
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k) {
+                    int expected = 0;
+                    for (int nb : reduce_v2v_table[v])
+                        if (nb != -1)
+                            expected += in[nb][k];
+                    EXPECT_EQ(out[v][k], expected);
+                }
+        }
+
+        // the accumulator takes the type of the values, not of the integer init
+        TEST(unstructured, reduce_neighbors_double) {
+            double in[3][5], out[3][5] = {};
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k)
+                    in[v][k] = 1.25 * v + .5 * k;
+
+            auto domain = unstructured_domain({3, 5}, {}, connectivity<v2v>(&reduce_v2v_table[0]));
+            auto backend = make_backend(backend::naive(), domain);
+            backend.stencil_executor()().arg(out).arg(in).assign(0_c, reduce_stencil<v2v>(), 1_c).execute();
+
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k) {
+                    double expected = 0;
+                    for (int nb : reduce_v2v_table[v])
+                        if (nb != -1)
+                            expected += in[nb][k];
+                    EXPECT_DOUBLE_EQ(out[v][k], expected);
+                }
+        }
+
+        struct e2c {};
+
+        // the boundary edges have a single cell and there are more edges than cells
+        TEST(unstructured, reduce_neighbors_e2c) {
+            std::array<int, 2> const e2c_table[5] = {{0, -1}, {-1, 0}, {0, 1}, {1, -1}, {-1, -1}};
+
+            int in[2][5], out[5][5] = {};
+            for (int c = 0; c < 2; ++c)
+                for (int k = 0; k < 5; ++k)
+                    in[c][k] = 5 * c + k + 1;
+
+            auto domain = unstructured_domain({5, 5}, {}, connectivity<e2c>(&e2c_table[0]));
+            auto backend = make_backend(backend::naive(), domain);
+            backend.stencil_executor()().arg(out).arg(in).assign(0_c, reduce_stencil<e2c>(), 1_c).execute();
+
+            for (int e = 0; e < 5; ++e)
+                for (int k = 0; k < 5; ++k) {
+                    int expected = 0;
+                    for (int nb : e2c_table[e])
+                        if (nb != -1)
+                            expected += in[nb][k];
+                    EXPECT_EQ(out[e][k], expected);
+                }
+        }
+
+        TEST(unstructured, reduce_neighbors_weighted) {
+            int a[3][5], b[3][5], out[3][5] = {};
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k) {
+                    a[v][k] = 5 * v + k;
+                    b[v][k] = v - k;
+                }
+            std::array<int, 3> weights[3] = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+            auto domain = unstructured_domain({3, 5}, {}, connectivity<v2v>(&reduce_v2v_table[0]));
+            auto backend = make_backend(backend::naive(), domain);
+            backend.stencil_executor()()
+                .arg(out)
+                .arg(weights)
+                .arg(a)
+                .arg(b)
+                .assign(0_c, weighted_reduce_stencil(), 1_c, 2_c, 3_c)
+                .execute();
+
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k) {
+                    int expected = 1;
+                    for (int i = 0; i < 3; ++i) {
+                        int nb = reduce_v2v_table[v][i];
+                        if (nb != -1)
+                            expected += weights[v][i] * a[nb][k] * b[nb][k];
+                    }
+                    EXPECT_EQ(out[v][k], expected);
+                }
+        }
+
+        TEST(unstructured, reduce_neighbors_tuple) {
+            int in[3][5], out[3][5] = {};
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k)
+                    in[v][k] = 5 * v + k;
+
+            auto domain = unstructured_domain({3, 5}, {}, connectivity<v2v>(&reduce_v2v_table[0]));
+            auto backend = make_backend(backend::naive(), domain);
+            backend.stencil_executor()().arg(out).arg(in).assign(0_c, tuple_reduce_stencil(), 1_c).execute();
+
+            for (int v = 0; v < 3; ++v)
+                for (int k = 0; k < 5; ++k) {
+                    int sum = 0, count = 0;
+                    for (int nb : reduce_v2v_table[v])
+                        if (nb != -1) {
+                            sum += in[nb][k];
+                            ++count;
+                        }
+                    EXPECT_EQ(out[v][k], 10 * sum + count);
+                }
+        }
     } // namespace
 } // namespace gridtools::fn
@@ -9,6 +9,9 @@
  */
 #include <gridtools/layout_transformation.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <gridtools/common/array.hpp>
@@ -122,4 +125,36 @@ namespace {
             }
         });
     }
+
+    // the sizes are not multiples of the tile sizes; all the permutations of the strides are checked
+    TEST(layout_transformation, tiled_4D_permutations) {
+        array<size_t, 4> dims = {37, 70, 3, 5};
+        auto strides = [&](array<size_t, 4> const &order) {
+            array<size_t, 4> res;
+            size_t stride = 1;
+            for (size_t d : order) {
+                res[d] = stride;
+                stride *= dims[d];
+            }
+            return res;
+        };
+        std::vector<int> src(37 * 70 * 3 * 5);
+        std::vector<int> dst(src.size());
+        array<size_t, 4> src_order = {1, 3, 0, 2};
+        auto src_strides = strides(src_order);
+        for (auto i : make_hypercube_view(dims))
+            src[i[0] * src_strides[0] + i[1] * src_strides[1] + i[2] * src_strides[2] + i[3] * src_strides[3]] =
+                1000 * i[0] + 100 * i[1] + 10 * i[2] + i[3];
+        array<size_t, 4> dst_order = {0, 1, 2, 3};
+        for (bool nontemporal : {false, true})
+            do {
+                auto dst_strides = strides(dst_order);
+                std::fill(dst.begin(), dst.end(), -1);
+                transform_layout(dst.data(), src.data(), dims, dst_strides, src_strides, nontemporal);
+                for (auto i : make_hypercube_view(dims))
+                    ASSERT_EQ(dst[i[0] * dst_strides[0] + i[1] * dst_strides[1] + i[2] * dst_strides[2] +
+                                  i[3] * dst_strides[3]],
+                        1000 * i[0] + 100 * i[1] + 10 * i[2] + i[3]);
+            } while (std::next_permutation(dst_order.begin(), dst_order.end()));
+    }
 } // namespace
@@ -0,0 +1,116 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gridtools/reduction/cpu_reproducible.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <omp.h>
+
+#include <gridtools/reduction/functions.hpp>
+
+namespace gridtools {
+    namespace reduction {
+        namespace {
+            // values of very different magnitudes, so that the result of the naive summation depends on the order
+            template <class T>
+            std::vector<T> make_data(size_t n) {
+                size_t rounded = reduction_round_size(cpu_reproducible(), n);
+                std::vector<T> res(rounded);
+                std::mt19937 gen(42);
+                std::uniform_real_distribution<T> mantissa(-1, 1);
+                std::uniform_int_distribution<int> exponent(-20, 20);
+                for (size_t i = 0; i != n; ++i)
+                    res[i] = std::ldexp(mantissa(gen), exponent(gen));
+                reduction_fill(cpu_reproducible(), T(0), res.data(), 1, n, n, rounded);
+                return res;
+            }
+
+            template <class F, class T>
+            std::vector<T> reduce_with_threads(F f, T neutral, std::vector<T> const &data) {
+                int max_threads = omp_get_max_threads();
+                std::vector<T> res;
+                for (int threads : {1, 2, 3, 4, 7, 16}) {
+                    omp_set_num_threads(threads);
+                    res.push_back(reduction_reduce(cpu_reproducible(), neutral, f, data.data(), data.size()));
+                }
+                omp_set_num_threads(max_threads);
+                return res;
+            }
+
+            TEST(cpu_reproducible, round_size) {
+                EXPECT_EQ(0, reduction_round_size(cpu_reproducible(), 0));
+                EXPECT_EQ(16, reduction_round_size(cpu_reproducible(), 1));
+                EXPECT_EQ(16, reduction_round_size(cpu_reproducible(), 16));
+                EXPECT_EQ(32, reduction_round_size(cpu_reproducible(), 17));
+            }
+
+            TEST(cpu_reproducible, empty) {
+                EXPECT_EQ(3., reduction_reduce(cpu_reproducible(), 3., plus(), (double const *)nullptr, 0));
+            }
+
+            TEST(cpu_reproducible, sum_is_thread_count_independent) {
+                auto data = make_data<double>(1234567);
+                auto results = reduce_with_threads(plus(), 0., data);
+                for (double res : results)
+                    EXPECT_EQ(results.front(), res);
+
+                long double expected = 0;
+                for (double x : data)
+                    expected += x;
+                EXPECT_NEAR(double(expected), results.front(), std::abs(double(expected)) * 1e-15);
+            }
+
+            TEST(cpu_reproducible, float_sum) {
+                auto data = make_data<float>(100003);
+                auto results = reduce_with_threads(plus(), 0.f, data);
+                for (float res : results)
+                    EXPECT_EQ(results.front(), res);
+
+                double expected = 0;
+                for (float x : data)
+                    expected += x;
+                EXPECT_NEAR(expected, results.front(), std::abs(expected) * 1e-6);
+            }
+
+            TEST(cpu_reproducible, product) {
+                std::vector<double> data(50000, 1.);
+                for (size_t i = 0; i < data.size(); i += 997)
+                    data[i] = i % 2 ? 1.001 : .999;
+                auto results = reduce_with_threads(mul(), 1., data);
+                for (double res : results)
+                    EXPECT_EQ(results.front(), res);
+            }
+
+            TEST(cpu_reproducible, min_max) {
+                auto data = make_data<double>(77777);
+                data[12345] = 1e10;
+                data[54321] = -1e10;
+                for (double res : reduce_with_threads(max(), -1e300, data))
+                    EXPECT_EQ(1e10, res);
+                for (double res : reduce_with_threads(min(), 1e300, data))
+                    EXPECT_EQ(-1e10, res);
+            }
+
+            TEST(cpu_reproducible, integral) {
+                std::vector<int> data(10000);
+                for (size_t i = 0; i != data.size(); ++i)
+                    data[i] = i;
+                for (int res : reduce_with_threads(plus(), 0, data))
+                    EXPECT_EQ(49995000, res);
+                for (int res : reduce_with_threads(bitwise_or(), 0, data))
+                    EXPECT_EQ(16383, res);
+            }
+        } // namespace
+    }     // namespace reduction
+} // namespace gridtools
@@ -0,0 +1,112 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gridtools/reduction/global.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <gridtools/reduction.hpp>
+#include <gridtools/reduction/cpu_reproducible.hpp>
+#include <gridtools/sid/concept.hpp>
+#include <gridtools/storage/cpu_ifirst.hpp>
+
+namespace gridtools {
+    namespace reduction {
+        namespace {
+            constexpr int n = 1000;
+
+            int rank() {
+                int res;
+                MPI_Comm_rank(MPI_COMM_WORLD, &res);
+                return res;
+            }
+
+            int ranks() {
+                int res;
+                MPI_Comm_size(MPI_COMM_WORLD, &res);
+                return res;
+            }
+
+            template <class Fun>
+            auto make_testee(Fun &&fun, double neutral = 0.) {
+                auto res = make_reducible<cpu_reproducible, storage::cpu_ifirst>(neutral, n);
+                auto ptr = sid::get_origin(res)();
+                for (int i = 0; i != n; ++i)
+                    ptr[i] = fun(i + rank() * n);
+                return res;
+            }
+
+            TEST(reduce_global, sum) {
+                auto testee = make_testee([](int i) { return i; });
+                double total = n * ranks();
+                EXPECT_EQ(total * (total - 1) / 2, reduce_global(MPI_COMM_WORLD, testee, plus()));
+            }
+
+            TEST(reduce_global, nonblocking) {
+                auto fun = [](int i) { return i % 7 - 3 * i; };
+                auto min_testee = make_testee(fun, std::numeric_limits<double>::max());
+                auto max_testee = make_testee(fun, std::numeric_limits<double>::lowest());
+                auto pending_min = ireduce_global(MPI_COMM_WORLD, min_testee, min());
+                auto pending_max = ireduce_global(MPI_COMM_WORLD, max_testee, max());
+                // the independent work goes here
+                double local_sum = make_testee(fun).reduce(plus());
+                double expected_sum = 0;
+                for (int i = 0; i != n; ++i)
+                    expected_sum += fun(i + rank() * n);
+                EXPECT_EQ(expected_sum, local_sum);
+                int last = n * ranks() - 1;
+                EXPECT_EQ(last % 7 - 3 * last, pending_min.wait());
+                EXPECT_EQ(0, pending_max.wait());
+            }
+
+            // the types that MPI doesn't have exactly are gathered instead of being converted
+            static_assert(global_impl_::has_mpi_op<plus, std::int32_t>::value);
+            static_assert(global_impl_::has_mpi_op<max, float>::value);
+            static_assert(!global_impl_::has_mpi_op<plus, bool>::value);
+            static_assert(!global_impl_::has_mpi_op<plus, char>::value);
+
+            TEST(reduce_global, ordered) {
+                auto testee = make_testee([](int i) { return std::sin(i) * std::pow(10., i % 13 - 6); });
+                double res = reduce_global_ordered(MPI_COMM_WORLD, testee, plus());
+
+                double local = testee.reduce(plus());
+                std::vector<double> partials(ranks());
+                MPI_Allgather(&local, 1, MPI_DOUBLE, partials.data(), 1, MPI_DOUBLE, MPI_COMM_WORLD);
+                double expected = partials[0];
+                for (int i = 1; i < ranks(); ++i)
+                    expected += partials[i];
+                EXPECT_EQ(expected, res);
+
+                double lo, hi;
+                MPI_Allreduce(&res, &lo, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+                MPI_Allreduce(&res, &hi, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                EXPECT_EQ(lo, hi);
+
+                auto pending = ireduce_global_ordered(MPI_COMM_WORLD, testee, plus());
+                EXPECT_EQ(res, pending.wait());
+            }
+
+            struct abs_max {
+                double operator()(double x, double y) const { return std::max(std::abs(x), std::abs(y)); }
+            };
+
+            TEST(reduce_global, user_function) {
+                auto testee = make_testee([](int i) { return i % 2 ? -i : i; });
+                EXPECT_EQ(n * ranks() - 1, reduce_global(MPI_COMM_WORLD, testee, abs_max()));
+            }
+        } // namespace
+    }     // namespace reduction
+} // namespace gridtools
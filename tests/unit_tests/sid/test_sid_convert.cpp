@@ -0,0 +1,138 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gridtools/sid/convert.hpp>
+
+#include <limits>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <gridtools/common/bfloat16.hpp>
+#include <gridtools/common/hymap.hpp>
+#include <gridtools/common/integral_constant.hpp>
+#include <gridtools/common/tuple_util.hpp>
+#include <gridtools/sid/block.hpp>
+#include <gridtools/sid/composite.hpp>
+#include <gridtools/sid/concept.hpp>
+
+namespace gridtools {
+    namespace {
+        using namespace literals;
+
+        using dim_0 = integral_constant<int, 0>;
+        using dim_1 = integral_constant<int, 1>;
+
+        TEST(sid_convert, smoke) {
+            float data[3][5] = {};
+            data[1][2] = 1.5f;
+
+            auto testee = sid::convert<double>(data);
+            using testee_t = decltype(testee);
+            static_assert(is_sid<testee_t>());
+            static_assert(std::is_same_v<sid::value_type<testee_t>, double>);
+            static_assert(std::is_same_v<sid::strides_kind<testee_t>, sid::strides_kind<decltype(data)>>);
+
+            auto strides = sid::get_strides(testee);
+            EXPECT_EQ(5, sid::get_stride<dim_0>(strides));
+            EXPECT_EQ(1, sid::get_stride<dim_1>(strides));
+            EXPECT_EQ(3, at_key<dim_0>(sid::get_upper_bounds(testee)));
+            EXPECT_EQ(5, at_key<dim_1>(sid::get_upper_bounds(testee)));
+
+            auto ptr = sid::get_origin(testee)();
+            sid::shift(ptr, sid::get_stride<dim_0>(strides), 1);
+            sid::shift(ptr, sid::get_stride<dim_1>(strides), 2);
+            EXPECT_EQ(1.5, double(*ptr));
+
+            *ptr = 2.25;
+            EXPECT_EQ(2.25f, data[1][2]);
+            *ptr += 1.;
+            EXPECT_EQ(3.25f, data[1][2]);
+
+            auto other = sid::get_origin(testee)() + 1;
+            *other = *ptr;
+            EXPECT_EQ(3.25f, data[0][1]);
+        }
+
+        TEST(sid_convert, const_source) {
+            float const data[4] = {0, 1, 2, 3};
+            auto testee = sid::convert<double>(data);
+            static_assert(std::is_same_v<sid::reference_type<decltype(testee)>, double>);
+
+            auto ptr = sid::get_origin(testee)();
+            sid::shift(ptr, sid::get_stride<dim_0>(sid::get_strides(testee)), 3);
+            EXPECT_EQ(3., *ptr);
+        }
+
+        TEST(sid_convert, narrowing) {
+            float data[1] = {};
+            auto testee = sid::convert<double>(data);
+            auto ptr = sid::get_origin(testee)();
+            *ptr = 1. + 1e-12;
+            EXPECT_EQ(1.f, data[0]);
+        }
+
+        TEST(sid_convert, composite) {
+            float in[4] = {1, 2, 3, 4};
+            double out[4] = {};
+            struct a;
+            struct b;
+            auto testee = sid::composite::keys<a, b>::make_values(sid::convert<double>(in), out);
+            static_assert(is_sid<decltype(testee)>());
+
+            auto ptr = sid::get_origin(testee)();
+            auto stride = sid::get_stride<dim_0>(sid::get_strides(testee));
+            for (int i = 0; i < 4; ++i) {
+                *at_key<b>(ptr) = 2 * *at_key<a>(ptr);
+                sid::shift(ptr, stride, 1_c);
+            }
+            for (int i = 0; i < 4; ++i)
+                EXPECT_EQ(2. * (i + 1), out[i]);
+        }
+
+        TEST(sid_convert, block) {
+            float data[6][4] = {};
+            auto testee = sid::block(sid::convert<double>(data), hymap::keys<dim_0>::make_values(2_c));
+            static_assert(is_sid<decltype(testee)>());
+
+            auto strides = sid::get_strides(testee);
+            auto ptr = sid::get_origin(testee)();
+            sid::shift(ptr, sid::get_stride<sid::blocked_dim<dim_0>>(strides), 2);
+            sid::shift(ptr, sid::get_stride<dim_0>(strides), 1);
+            sid::shift(ptr, sid::get_stride<dim_1>(strides), 3);
+            *ptr = 42.;
+            EXPECT_EQ(42.f, data[5][3]);
+        }
+
+        TEST(sid_convert, bfloat16) {
+            bfloat16 data[3] = {};
+            auto testee = sid::convert<double>(data);
+            auto ptr = sid::get_origin(testee)();
+            *ptr = 1.5;
+            EXPECT_EQ(1.5f, float(data[0]));
+            sid::shift(ptr, sid::get_stride<dim_0>(sid::get_strides(data)), 1);
+            *ptr = 1. / 3;
+            EXPECT_NE(1. / 3, double(*ptr));
+            EXPECT_NEAR(1. / 3, double(*ptr), 1. / 256);
+        }
+
+        TEST(bfloat16, conversion) {
+            EXPECT_EQ(0x3f80, bfloat16(1.f).bits());
+            EXPECT_EQ(-2.f, float(bfloat16(-2.f)));
+            // round to nearest even
+            EXPECT_EQ(0x3f80, bfloat16(1.00390625f).bits());
+            EXPECT_EQ(0x3f82, bfloat16(1.01171875f).bits());
+            EXPECT_EQ(0x3f81, bfloat16(1.005f).bits());
+            // NaN stays NaN
+            float nan = float(bfloat16(std::numeric_limits<float>::quiet_NaN()));
+            EXPECT_NE(nan, nan);
+        }
+    } // namespace
+} // namespace gridtools
@@ -13,6 +13,8 @@
 #include <cpp_bindgen/fortran_array_view.hpp>
 #include <gridtools/storage/adapter/fortran_array_adapter.hpp>
 #include <gridtools/storage/builder.hpp>
+#include <gridtools/sid/concept.hpp>
+#include <gridtools/storage/cpu_ifirst.hpp>
 #include <gridtools/storage/cpu_kfirst.hpp>
 
 const auto builder = gridtools::storage::builder<gridtools::storage::cpu_kfirst>.type<double>();
@@ -85,3 +87,88 @@ TEST(FortranArrayAdapter, TransformDataStoreIntoAdapter) {
             for (size_t x = 0; x < x_size; ++x, ++i)
                 EXPECT_EQ(fortran_array[z][y][x], i);
 }
+
+TEST(FortranArrayAdapter, ZeroCopySid) {
+    constexpr size_t x_size = 6;
+    constexpr size_t y_size = 5;
+    constexpr size_t z_size = 4;
+    double fortran_array[z_size][y_size][x_size] = {};
+
+    bindgen_fortran_array_descriptor descriptor;
+    descriptor.rank = 3;
+    descriptor.dims[0] = x_size;
+    descriptor.dims[1] = y_size;
+    descriptor.dims[2] = z_size;
+    descriptor.type = bindgen_fk_Double;
+    descriptor.data = fortran_array;
+    descriptor.is_acc_present = false;
+
+    // the unit stride dimension of cpu_ifirst is the first one, the data is used in place
+    auto data_store =
+        gridtools::storage::builder<gridtools::storage::cpu_ifirst>.type<double>().dimensions(x_size, y_size, z_size)();
+    using adapter_t = gridtools::fortran_array_adapter<decltype(data_store)>;
+    static_assert(adapter_t::is_zero_copy);
+
+    auto testee = adapter_t{descriptor}.sid(data_store);
+    static_assert(gridtools::is_sid<decltype(testee)>::value);
+    using dim_0 = gridtools::integral_constant<int, 0>;
+    using dim_1 = gridtools::integral_constant<int, 1>;
+    using dim_2 = gridtools::integral_constant<int, 2>;
+    auto strides = gridtools::sid::get_strides(testee);
+    EXPECT_EQ(1, gridtools::sid::get_stride<dim_0>(strides));
+    EXPECT_EQ(x_size, gridtools::sid::get_stride<dim_1>(strides));
+    EXPECT_EQ(x_size * y_size, gridtools::sid::get_stride<dim_2>(strides));
+
+    auto ptr = gridtools::sid::get_origin(testee)();
+    gridtools::sid::shift(ptr, gridtools::sid::get_stride<dim_0>(strides), 1);
+    gridtools::sid::shift(ptr, gridtools::sid::get_stride<dim_2>(strides), 3);
+    *ptr = 42;
+    EXPECT_EQ(42, fortran_array[3][0][1]);
+}
+
+TEST(FortranArrayAdapter, CopySid) {
+    constexpr size_t x_size = 6;
+    constexpr size_t y_size = 5;
+    constexpr size_t z_size = 4;
+    double fortran_array[z_size][y_size][x_size];
+
+    bindgen_fortran_array_descriptor descriptor;
+    descriptor.rank = 3;
+    descriptor.dims[0] = x_size;
+    descriptor.dims[1] = y_size;
+    descriptor.dims[2] = z_size;
+    descriptor.type = bindgen_fk_Double;
+    descriptor.data = fortran_array;
+    descriptor.is_acc_present = false;
+
+    int i = 0;
+    for (size_t z = 0; z < z_size; ++z)
+        for (size_t y = 0; y < y_size; ++y)
+            for (size_t x = 0; x < x_size; ++x, ++i)
+                fortran_array[z][y][x] = i;
+
+    // the unit stride dimension of cpu_kfirst is the last one, the data goes through the data store
+    auto data_store = builder.dimensions(x_size, y_size, z_size)();
+    using adapter_t = gridtools::fortran_array_adapter<decltype(data_store)>;
+    static_assert(!adapter_t::is_zero_copy);
+
+    adapter_t adapter{descriptor};
+    auto testee = adapter.sid(data_store);
+    EXPECT_EQ(data_store, testee);
+
+    auto view = data_store->host_view();
+    i = 0;
+    for (size_t z = 0; z < z_size; ++z)
+        for (size_t y = 0; y < y_size; ++y)
+            for (size_t x = 0; x < x_size; ++x, ++i) {
+                EXPECT_EQ(view(x, y, z), i);
+                view(x, y, z) = -i;
+            }
+
+    adapter.write_back(data_store);
+    i = 0;
+    for (size_t z = 0; z < z_size; ++z)
+        for (size_t y = 0; y < y_size; ++y)
+            for (size_t x = 0; x < x_size; ++x, ++i)
+                EXPECT_EQ(fortran_array[z][y][x], -i);
+}
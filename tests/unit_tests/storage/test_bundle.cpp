@@ -0,0 +1,112 @@
+/*
+ * GridTools
+ *
+ * Copyright (c) 2014-2023, ETH Zurich
+ * All rights reserved.
+ *
+ * Please, refer to the LICENSE file in the root directory.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <gridtools/storage/bundle.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <gridtools/common/hymap.hpp>
+#include <gridtools/common/integral_constant.hpp>
+#include <gridtools/common/layout_map.hpp>
+#include <gridtools/common/tuple_util.hpp>
+#include <gridtools/sid/concept.hpp>
+#include <gridtools/storage/builder.hpp>
+
+#include <storage_select.hpp>
+
+namespace gridtools {
+    namespace {
+        namespace tu = tuple_util;
+        using storage::interleaved_layout;
+
+        template <int_t I>
+        using dim = integral_constant<int_t, I>;
+
+        static_assert(std::is_same_v<interleaved_layout<layout_map<2, 1, 0>>::type, layout_map<3, 1, 0, 2>>);
+        static_assert(std::is_same_v<interleaved_layout<layout_map<0, 1, 2>>::type, layout_map<0, 1, 3, 2>>);
+        static_assert(std::is_same_v<interleaved_layout<layout_map<1, -1, 0>>::type, layout_map<2, -1, 0, 1>>);
+        static_assert(std::is_same_v<interleaved_layout<layout_map<-1>>::type, layout_map<-1, 0>>);
+
+        const auto builder = storage::builder<storage_traits_t>.type<double>();
+
+        TEST(bundle, smoke) {
+            auto testee = builder.dimensions(10, 20, 30).halos(2, 2, 0).build_bundle<3>();
+            auto const &ds = testee.data_store();
+
+            static_assert(decltype(testee)::ndims == 3);
+            static_assert(decltype(testee)::size == 3);
+            EXPECT_EQ(ds->lengths()[3], 3);
+
+            auto c0 = testee.component(0);
+            using component_t = decltype(c0);
+            static_assert(sid::concept_impl_::is_sid<component_t>());
+            static_assert(std::is_same_v<sid::ptr_type<component_t>, double *>);
+            static_assert(tu::size<sid::strides_type<component_t>>() == 3);
+            static_assert(
+                !std::is_same_v<sid::strides_kind<component_t>, typename std::decay_t<decltype(*ds)>::kind_t>);
+
+            auto &&ds_strides = ds->strides();
+            for (int n = 0; n < 3; ++n) {
+                auto c = testee.component(n);
+                static_assert(std::is_same_v<decltype(c), component_t>);
+                auto strides = sid::get_strides(c);
+                EXPECT_EQ(ds_strides[0], at_key<dim<0>>(strides));
+                EXPECT_EQ(ds_strides[1], at_key<dim<1>>(strides));
+                EXPECT_EQ(ds_strides[2], at_key<dim<2>>(strides));
+
+                auto upper_bounds = sid::get_upper_bounds(c);
+                EXPECT_EQ(10, at_key<dim<0>>(upper_bounds));
+                EXPECT_EQ(20, at_key<dim<1>>(upper_bounds));
+                EXPECT_EQ(30, at_key<dim<2>>(upper_bounds));
+
+                auto ptr = sid::get_origin(c)();
+                EXPECT_EQ(ds->get_target_ptr() + n * ds_strides[3], ptr);
+                sid::shift(ptr, at_key<dim<0>>(strides), 2);
+                sid::shift(ptr, at_key<dim<1>>(strides), 2);
+                EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(ptr) % storage::traits::byte_alignment<storage_traits_t>);
+            }
+        }
+
+        TEST(bundle, components_are_interleaved) {
+            auto testee = builder.dimensions(5, 6, 7).build_bundle<4>();
+            auto &&strides = testee.data_store()->strides();
+            using layout_t = storage::traits::layout_type<storage_traits_t, 3>;
+            constexpr int innermost = layout_t::find(layout_t::max_arg);
+            constexpr int next = layout_t::find(layout_t::max_arg - 1);
+            EXPECT_EQ(1, strides[innermost]);
+            EXPECT_GE(strides[3], testee.data_store()->lengths()[innermost]);
+            EXPECT_EQ(4 * strides[3], strides[next]);
+        }
+
+        TEST(bundle, initializer) {
+            auto testee =
+                builder.dimensions(4, 5, 6).initializer([](int i, int j, int k, int n) { return i + j + k + n; })
+                    .build_bundle<2>();
+            auto view = testee.data_store()->const_host_view();
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 5; ++j)
+                    for (int k = 0; k < 6; ++k)
+                        for (int n = 0; n < 2; ++n)
+                            EXPECT_EQ(i + j + k + n, view(i, j, k, n));
+        }
+
+        TEST(bundle, value) {
+            auto testee = builder.dimensions(4, 5, 6).value(42).build_bundle<3>();
+            auto view = testee.data_store()->const_host_view();
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 5; ++j)
+                    for (int k = 0; k < 6; ++k)
+                        for (int n = 0; n < 3; ++n)
+                            EXPECT_EQ(42, view(i, j, k, n));
+        }
+    } // namespace
+} // namespace gridtools
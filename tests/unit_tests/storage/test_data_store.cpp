@@ -8,6 +8,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <cmath>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -48,6 +50,25 @@ TEST(DataStoreTest, Initializer) {
                 EXPECT_DOUBLE_EQ(view(i, j, k), 3.1415);
 }
 
+TEST(DataStoreTest, ZeroInitializer) {
+    // large enough to be allocated with `mmap`
+    auto ds = builder.dimensions(128, 128, 80).halos(2, 2, 0).value(0).build();
+    auto view = ds->const_host_view();
+    for (uint_t i = 0; i < 128; ++i)
+        for (uint_t j = 0; j < 128; ++j)
+            for (uint_t k = 0; k < 80; ++k)
+                EXPECT_EQ(view(i, j, k), 0);
+}
+
+TEST(DataStoreTest, NegativeZeroInitializer) {
+    auto ds = builder.dimensions(3, 4, 5).value(-0.).build();
+    auto view = ds->const_host_view();
+    for (uint_t i = 0; i < 3; ++i)
+        for (uint_t j = 0; j < 4; ++j)
+            for (uint_t k = 0; k < 5; ++k)
+                EXPECT_TRUE(std::signbit(view(i, j, k)));
+}
+
 TEST(DataStoreTest, LambdaInitializer) {
     auto ds = builder.dimensions(10, 11, 12).initializer([](int i, int j, int k) { return i + j + k; }).build();
     auto lengths = ds->lengths();